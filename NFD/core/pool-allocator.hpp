@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_POOL_ALLOCATOR_HPP
+#define NFD_CORE_POOL_ALLOCATOR_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief a free list of fixed-size chunks, carved out of large blocks
+ *
+ *  The chunk size is set by the first allocation; requests for more than one chunk size are
+ *  passed through to operator new. Chunks are never returned to the system: a released chunk
+ *  is reused by the next allocation, which fits tables whose entries churn at a steady rate.
+ *  Not thread-safe.
+ */
+class FixedSizePool : noncopyable
+{
+public:
+  explicit
+  FixedSizePool(size_t nChunksPerBlock = 1024)
+    : m_chunkSize(0)
+    , m_nChunksPerBlock(nChunksPerBlock)
+    , m_freeList(nullptr)
+    , m_nAllocatedChunks(0)
+  {
+  }
+
+  ~FixedSizePool()
+  {
+    for (char* block : m_blocks) {
+      ::operator delete(block);
+    }
+  }
+
+  void*
+  allocate(size_t size)
+  {
+    if (m_chunkSize == 0) {
+      m_chunkSize = roundUp(std::max(size, sizeof(FreeChunk)));
+    }
+    if (size > m_chunkSize) {
+      return ::operator new(size);
+    }
+
+    if (m_freeList == nullptr) {
+      addBlock();
+    }
+    FreeChunk* chunk = m_freeList;
+    m_freeList = chunk->next;
+    ++m_nAllocatedChunks;
+    return chunk;
+  }
+
+  /** \param size the size passed to allocate()
+   */
+  void
+  deallocate(void* p, size_t size)
+  {
+    if (size > m_chunkSize) {
+      ::operator delete(p);
+      return;
+    }
+
+    FreeChunk* chunk = static_cast<FreeChunk*>(p);
+    chunk->next = m_freeList;
+    m_freeList = chunk;
+    --m_nAllocatedChunks;
+  }
+
+  /// chunk size in bytes, 0 before the first allocation
+  size_t
+  getChunkSize() const
+  {
+    return m_chunkSize;
+  }
+
+  /// number of chunks currently handed out
+  size_t
+  getNAllocatedChunks() const
+  {
+    return m_nAllocatedChunks;
+  }
+
+  /// bytes reserved from the system, including free chunks
+  size_t
+  getNReservedBytes() const
+  {
+    return m_blocks.size() * m_nChunksPerBlock * m_chunkSize;
+  }
+
+private:
+  struct FreeChunk
+  {
+    FreeChunk* next;
+  };
+
+  /// chunks are aligned for any fundamental type
+  static const size_t ALIGNMENT = 16;
+
+  static size_t
+  roundUp(size_t size)
+  {
+    return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  }
+
+  void
+  addBlock()
+  {
+    char* block = static_cast<char*>(::operator new(m_nChunksPerBlock * m_chunkSize));
+    m_blocks.push_back(block);
+    for (size_t i = m_nChunksPerBlock; i > 0; --i) {
+      FreeChunk* chunk = reinterpret_cast<FreeChunk*>(block + (i - 1) * m_chunkSize);
+      chunk->next = m_freeList;
+      m_freeList = chunk;
+    }
+  }
+
+private:
+  size_t m_chunkSize;
+  size_t m_nChunksPerBlock;
+  FreeChunk* m_freeList;
+  size_t m_nAllocatedChunks;
+  std::vector<char*> m_blocks;
+};
+
+namespace detail {
+
+template<typename Tag>
+struct TaggedPool
+{
+  /** The pool is intentionally leaked, so that objects released during static destruction
+   *  still find it.
+   */
+  static FixedSizePool&
+  get()
+  {
+    static FixedSizePool* pool = new FixedSizePool();
+    return *pool;
+  }
+};
+
+} // namespace detail
+
+/** \brief stateless allocator that takes single objects from the FixedSizePool of \p Tag
+ *
+ *  All allocators rebound from PoolAllocator<T, Tag> share the pool of \p Tag. This is meant
+ *  for allocate_shared, which rebinds the allocator to its internal control block type
+ *  and allocates one object of that type:
+ *  \code
+ *  shared_ptr<pit::Entry> entry = std::allocate_shared<pit::Entry>(PoolAllocator<pit::Entry>(),
+ *                                                                  interest);
+ *  \endcode
+ *  places the entry and its control block together in one pooled chunk.
+ *  Arrays (n > 1) are passed through to operator new.
+ */
+template<typename T, typename Tag = T>
+class PoolAllocator
+{
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef PoolAllocator<U, Tag> other;
+  };
+
+  PoolAllocator()
+  {
+  }
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U, Tag>&)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n != 1) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(getPool().allocate(sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n)
+  {
+    if (n != 1) {
+      ::operator delete(p);
+      return;
+    }
+    getPool().deallocate(p, sizeof(T));
+  }
+
+  template<typename U, typename... Args>
+  void
+  construct(U* p, Args&&... args)
+  {
+    new (p) U(std::forward<Args>(args)...);
+  }
+
+  template<typename U>
+  void
+  destroy(U* p)
+  {
+    p->~U();
+  }
+
+  /** \brief the pool of \p Tag
+   */
+  static FixedSizePool&
+  getPool()
+  {
+    return detail::TaggedPool<Tag>::get();
+  }
+};
+
+template<typename T, typename U, typename Tag>
+inline bool
+operator==(const PoolAllocator<T, Tag>&, const PoolAllocator<U, Tag>&)
+{
+  return true;
+}
+
+template<typename T, typename U, typename Tag>
+inline bool
+operator!=(const PoolAllocator<T, Tag>&, const PoolAllocator<U, Tag>&)
+{
+  return false;
+}
+
+} // namespace nfd
+
+#endif // NFD_CORE_POOL_ALLOCATOR_HPP
@@ -46,11 +46,15 @@ struct EventMemberImplObjTraits<std::function<void()>> {
 namespace nfd {
 namespace scheduler {
 
+static uint64_t g_nScheduledEvents = 0;
+static uint64_t g_nCancelledEvents = 0;
+
 EventId
 schedule(const time::nanoseconds& after, const std::function<void()>& event)
 {
   ns3::EventId id = ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()),
                                              &std::function<void()>::operator(), event);
+  ++g_nScheduledEvents;
   return std::make_shared<ns3::EventId>(id);
 }
 
@@ -58,11 +62,42 @@ void
 cancel(const EventId& eventId)
 {
   if (eventId != nullptr) {
+    if (!eventId->IsExpired()) {
+      ++g_nCancelledEvents;
+    }
     ns3::Simulator::Remove(*eventId);
     const_cast<EventId&>(eventId).reset();
   }
 }
 
+uint64_t
+getNScheduledEvents()
+{
+  return g_nScheduledEvents;
+}
+
+uint64_t
+getNCancelledEvents()
+{
+  return g_nCancelledEvents;
+}
+
+namespace detail {
+
+void
+countScheduled()
+{
+  ++g_nScheduledEvents;
+}
+
+void
+countCancelled()
+{
+  ++g_nCancelledEvents;
+}
+
+} // namespace detail
+
 ScopedEventId::ScopedEventId()
 {
 }
@@ -48,6 +48,78 @@ schedule(const time::nanoseconds& after, const std::function<void()>& event);
 void
 cancel(const EventId& eventId);
 
+/** \brief number of events scheduled so far, through schedule() or Timer
+ */
+uint64_t
+getNScheduledEvents();
+
+/** \brief number of pending events cancelled so far, through cancel() or Timer
+ */
+uint64_t
+getNCancelledEvents();
+
+/// @cond include_hidden
+namespace detail {
+
+void
+countScheduled();
+
+void
+countCancelled();
+
+} // namespace detail
+/// @endcond
+
+/** \brief a single event slot kept inside the object that owns it (e.g., a PIT entry)
+ *
+ *  Unlike schedule(), the event is a member function call handed directly to
+ *  ns3::Simulator, so no EventId or std::function is allocated. Scheduling again
+ *  cancels the pending event. As with EventId, destroying the Timer does not cancel the
+ *  event: arguments of the event must keep whatever it touches alive, or the owner
+ *  must cancel it.
+ */
+class Timer : noncopyable
+{
+public:
+  /** \brief schedule (obj->*memberFunction)(args...) after \p after
+   *
+   *  Up to five arguments are supported; they are copied into the event.
+   */
+  template<typename MemberFunction, typename Object, typename... Args>
+  void
+  schedule(const time::nanoseconds& after, MemberFunction memberFunction, Object obj,
+           Args... args)
+  {
+    this->cancel();
+    m_event = ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()),
+                                       memberFunction, obj, args...);
+    detail::countScheduled();
+  }
+
+  /** \brief cancel the pending event, if any
+   */
+  void
+  cancel()
+  {
+    if (isPending()) {
+      ns3::Simulator::Remove(m_event);
+      detail::countCancelled();
+    }
+    m_event = ns3::EventId();
+  }
+
+  /** \return whether an event is scheduled and has not run or been cancelled
+   */
+  bool
+  isPending() const
+  {
+    return m_event.GetUid() != 0 && !m_event.IsExpired();
+  }
+
+private:
+  ns3::EventId m_event;
+};
+
 /** \brief cancels an event automatically upon destruction
  */
 class ScopedEventId : noncopyable
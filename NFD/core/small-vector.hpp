@@ -0,0 +1,250 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_SMALL_VECTOR_HPP
+#define NFD_CORE_SMALL_VECTOR_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief a sequence container that stores up to \p N elements inline
+ *
+ *  Elements are contiguous; the container switches to a heap buffer when it grows past \p N.
+ *  It offers the subset of std::vector needed by table entries (e.g., PIT in-records and
+ *  out-records, of which most entries have one or two).
+ *
+ *  As with std::vector, inserting or erasing invalidates iterators.
+ */
+template<typename T, size_t N>
+class SmallVector : noncopyable
+{
+public:
+  typedef T value_type;
+  typedef size_t size_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* iterator;
+  typedef const T* const_iterator;
+
+  SmallVector()
+    : m_begin(getInlineStorage())
+    , m_size(0)
+    , m_capacity(N)
+  {
+  }
+
+  ~SmallVector()
+  {
+    clear();
+    if (!isInline()) {
+      ::operator delete(m_begin);
+    }
+  }
+
+  iterator
+  begin()
+  {
+    return m_begin;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_begin;
+  }
+
+  iterator
+  end()
+  {
+    return m_begin + m_size;
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_begin + m_size;
+  }
+
+  size_type
+  size() const
+  {
+    return m_size;
+  }
+
+  size_type
+  capacity() const
+  {
+    return m_capacity;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  reference
+  front()
+  {
+    BOOST_ASSERT(!empty());
+    return m_begin[0];
+  }
+
+  const_reference
+  front() const
+  {
+    BOOST_ASSERT(!empty());
+    return m_begin[0];
+  }
+
+  reference
+  back()
+  {
+    BOOST_ASSERT(!empty());
+    return m_begin[m_size - 1];
+  }
+
+  const_reference
+  back() const
+  {
+    BOOST_ASSERT(!empty());
+    return m_begin[m_size - 1];
+  }
+
+  reference
+  operator[](size_type i)
+  {
+    return m_begin[i];
+  }
+
+  const_reference
+  operator[](size_type i) const
+  {
+    return m_begin[i];
+  }
+
+  template<typename... Args>
+  reference
+  emplace_back(Args&&... args)
+  {
+    if (m_size == m_capacity) {
+      grow();
+    }
+    new (m_begin + m_size) T(std::forward<Args>(args)...);
+    return m_begin[m_size++];
+  }
+
+  /** \brief constructs an element before \p pos
+   *  \return iterator to the new element
+   */
+  template<typename... Args>
+  iterator
+  emplace(const_iterator pos, Args&&... args)
+  {
+    size_type index = pos - m_begin;
+    if (index == m_size) {
+      emplace_back(std::forward<Args>(args)...);
+      return m_begin + index;
+    }
+
+    T value(std::forward<Args>(args)...);
+    if (m_size == m_capacity) {
+      grow();
+    }
+    new (m_begin + m_size) T(std::move(m_begin[m_size - 1]));
+    ++m_size;
+    std::move_backward(m_begin + index, m_begin + m_size - 2, m_begin + m_size - 1);
+    m_begin[index] = std::move(value);
+    return m_begin + index;
+  }
+
+  template<typename... Args>
+  reference
+  emplace_front(Args&&... args)
+  {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  /** \brief erases the element at \p pos
+   *  \return iterator to the element that followed it
+   */
+  iterator
+  erase(const_iterator pos)
+  {
+    iterator it = m_begin + (pos - m_begin);
+    std::move(it + 1, end(), it);
+    m_begin[--m_size].~T();
+    return it;
+  }
+
+  void
+  clear()
+  {
+    for (size_type i = 0; i < m_size; ++i) {
+      m_begin[i].~T();
+    }
+    m_size = 0;
+  }
+
+private:
+  T*
+  getInlineStorage()
+  {
+    return reinterpret_cast<T*>(&m_inline);
+  }
+
+  bool
+  isInline() const
+  {
+    return m_begin == reinterpret_cast<const T*>(&m_inline);
+  }
+
+  void
+  grow()
+  {
+    size_type newCapacity = 2 * m_capacity;
+    T* newBegin = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+    for (size_type i = 0; i < m_size; ++i) {
+      new (newBegin + i) T(std::move(m_begin[i]));
+      m_begin[i].~T();
+    }
+    if (!isInline()) {
+      ::operator delete(m_begin);
+    }
+    m_begin = newBegin;
+    m_capacity = newCapacity;
+  }
+
+private:
+  T* m_begin;
+  size_type m_size;
+  size_type m_capacity;
+  typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type m_inline;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_SMALL_VECTOR_HPP
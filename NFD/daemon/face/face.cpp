@@ -49,12 +49,30 @@ Face::~Face()
 {
 }
 
+void
+Face::sendCachedData(const Data& data, const CsHit& hit)
+{
+  this->sendData(data);
+}
+
 bool
 Face::isUp() const
 {
   return true;
 }
 
+bool
+Face::isCongested() const
+{
+  return false;
+}
+
+bool
+Face::isHighlyCongested() const
+{
+  return false;
+}
+
 bool
 Face::decodeAndDispatchInput(const Block& element)
 {
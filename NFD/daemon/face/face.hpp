@@ -51,6 +51,19 @@ const FaceId FACEID_NULL = 255;
 /// upper bound of reserved FaceIds
 const FaceId FACEID_RESERVED_MAX = 255;
 
+/** \brief per-hit state of a Data served from the ContentStore
+ *
+ *  A cached Data is shared by all hits on its ContentStore entry and is never modified;
+ *  the forwarder and the strategy record what belongs to a single hit here instead.
+ */
+struct CsHit
+{
+  /// incomingFaceId of the Data, for LocalControlHeader
+  FaceId incomingFaceId = INVALID_FACEID;
+
+  /// congestion mark set by the strategy for this hit, or nullptr
+  shared_ptr<ndn::CongestionTag> congestionTag;
+};
 
 /** \brief represents a face
  */
@@ -99,6 +112,14 @@ public:
   virtual void
   sendData(const Data& data) = 0;
 
+  /** \brief send a Data served from the ContentStore
+   *
+   *  \p data is sent unchanged; \p hit carries the state of this hit.
+   *  In this base class this method ignores \p hit and calls sendData.
+   */
+  virtual void
+  sendCachedData(const Data& data, const CsHit& hit);
+
   /** \brief Close the face
    *
    *  This terminates all communication on the face and cause
@@ -151,6 +172,22 @@ public: // attributes
   virtual bool
   isUp() const;
 
+  /** \brief Get whether packets sent on this face should be congestion marked
+   *
+   *  In this base class this property is always false. Faces backed by an active queue
+   *  management queue (see ns3::ndn::NetDeviceFace) report the state of that queue.
+   */
+  virtual bool
+  isCongested() const;
+
+  /** \brief Get whether the send queue is almost full or its queuing delay has been over
+   *         target for a long time
+   *
+   *  In this base class this property is always false.
+   */
+  virtual bool
+  isHighlyCongested() const;
+
   const FaceCounters&
   getCounters() const;
 
@@ -44,6 +44,93 @@ public:
   {
     this->NetworkLayerCounters::copyTo(recipient);
   }
+
+public: // forwarding events
+  /// incoming Interest with a Nonce already seen in PIT or Dead Nonce List
+  const PacketCounter&
+  getNDuplicateNonces() const
+  {
+    return m_nDuplicateNonces;
+  }
+
+  PacketCounter&
+  getNDuplicateNonces()
+  {
+    return m_nDuplicateNonces;
+  }
+
+  /// Interest dropped by Interest loop pipeline
+  const PacketCounter&
+  getNInterestLoops() const
+  {
+    return m_nInterestLoops;
+  }
+
+  PacketCounter&
+  getNInterestLoops()
+  {
+    return m_nInterestLoops;
+  }
+
+  /// incoming Data carrying a NACK
+  const PacketCounter&
+  getNInNacks() const
+  {
+    return m_nInNacks;
+  }
+
+  PacketCounter&
+  getNInNacks()
+  {
+    return m_nInNacks;
+  }
+
+  /// PIT entry marked as congested by the strategy
+  const PacketCounter&
+  getNPitCongestionMarks() const
+  {
+    return m_nPitCongestionMarks;
+  }
+
+  PacketCounter&
+  getNPitCongestionMarks()
+  {
+    return m_nPitCongestionMarks;
+  }
+
+  /// Interest not forwarded by the strategy because no nexthop was eligible
+  const PacketCounter&
+  getNBlockedInterests() const
+  {
+    return m_nBlockedInterests;
+  }
+
+  PacketCounter&
+  getNBlockedInterests()
+  {
+    return m_nBlockedInterests;
+  }
+
+  /// pending Interest rejected by the strategy
+  const PacketCounter&
+  getNRejectedInterests() const
+  {
+    return m_nRejectedInterests;
+  }
+
+  PacketCounter&
+  getNRejectedInterests()
+  {
+    return m_nRejectedInterests;
+  }
+
+private:
+  PacketCounter m_nDuplicateNonces;
+  PacketCounter m_nInterestLoops;
+  PacketCounter m_nInNacks;
+  PacketCounter m_nPitCongestionMarks;
+  PacketCounter m_nBlockedInterests;
+  PacketCounter m_nRejectedInterests;
 };
 
 } // namespace nfd
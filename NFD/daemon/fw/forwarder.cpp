@@ -29,7 +29,6 @@
 #include "strategy.hpp"
 #include "face/null-face.hpp"
 
-#include "utils/ndn-ns3-packet-tag.hpp"
 #include "str-helper.hpp"
 
 #include <boost/random/uniform_int_distribution.hpp>
@@ -83,12 +82,11 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   // detect duplicate Nonce
   int dnw = pitEntry->findNonce(interest.getNonce(), inFace);
   bool hasDuplicateNonce = (dnw != pit::DUPLICATE_NONCE_NONE)
-      || m_deadNonceList.has(interest.getName(), interest.getNonce());
+      || m_deadNonceList.has(interest);
   if (hasDuplicateNonce) {
-    uint64_t seqNum = interest.getName().get(-1).toSequenceNumber();
-    std::cout << "Found duplicate nonce for Interest:" << seqNum << ", nonce: "
-        << interest.getNonce() << ", " << dnw << ", "
-        << m_deadNonceList.has(interest.getName(), interest.getNonce()) << "\n";
+    ++m_counters.getNDuplicateNonces();
+    NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() << " interest=" << interest.getName()
+                  << " duplicate nonce=" << interest.getNonce() << " pit=" << dnw);
 
     // goto Interest loop pipeline
     this->onInterestLoop(inFace, interest, pitEntry);
@@ -107,7 +105,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
           bind(&Forwarder::onContentStoreMiss, this, ref(inFace), pitEntry, _1));
     }
     else {
-      shared_ptr<Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
+      shared_ptr<const Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
       if (match != nullptr) {
         this->onContentStoreHit(inFace, pitEntry, interest, *match);
       }
@@ -165,29 +163,30 @@ Forwarder::onContentStoreHit(const Face& inFace,
 {
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
 
+  // the Data is shared by all hits on the CS entry, per-hit state goes to hit
+  CsHit hit;
+  hit.incomingFaceId = FACEID_CONTENT_STORE;
+
   beforeSatisfyInterest(*pitEntry, *m_csFace, data);
   this->dispatchToStrategy(pitEntry,
-      bind(&Strategy::beforeSatisfyInterest, _1, pitEntry, cref(*m_csFace), cref(data)));
+      bind(&Strategy::beforeSatisfyInterestFromCs, _1, pitEntry, cref(*m_csFace), cref(data),
+           ref(hit)));
 
-  const_pointer_cast<Data>(data.shared_from_this())->setIncomingFaceId(FACEID_CONTENT_STORE);
   // XXX should we lookup PIT for other Interests that also match csMatch?
 
   // set PIT straggler timer
   this->setStragglerTimer(pitEntry, true, data.getFreshnessPeriod());
 
   // goto outgoing Data pipeline
-  this->onOutgoingData(data, *const_pointer_cast<Face>(inFace.shared_from_this()));
+  this->onOutgoingData(data, *const_pointer_cast<Face>(inFace.shared_from_this()), &hit);
 }
 
 void
 Forwarder::onInterestLoop(Face& inFace, const Interest& interest, shared_ptr<pit::Entry> pitEntry)
 {
-  NFD_LOG_DEBUG("onInterestLoop face=" << inFace.getId() << " interest=" << interest.getName());
-
-  // Print cout on looping Interest!
-  std::cout << "Node " << m_nodeId << " Interest loop face=" << inFace.getId() << " interest="
-      << interest.getName().get(-1).toSequenceNumber() << ", nonce: " << interest.getNonce()
-      << "\n";
+  NFD_LOG_DEBUG("onInterestLoop node=" << m_nodeId << " face=" << inFace.getId()
+                << " interest=" << interest.getName() << " nonce=" << interest.getNonce());
+  ++m_counters.getNInterestLoops();
 
   // (drop)
 }
@@ -267,7 +266,7 @@ Forwarder::onInterestReject(shared_ptr<pit::Entry> pitEntry)
     return;
   }
   NFD_LOG_DEBUG("onInterestReject interest=" << pitEntry->getName());
-  std::cout << "onInterestReject interest=" << pitEntry->getName() << "\n";
+  ++m_counters.getNRejectedInterests();
 
   // cancel unsatisfy & straggler timer
   this->cancelUnsatisfyAndStragglerTimer(pitEntry);
@@ -332,16 +331,8 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     return;
   }
 
-  // Remove Ptr<Packet> from the Data before inserting into cache, serving two purposes
-  // - reduce amount of memory used by cached entries
-  // - remove all tags that (e.g., hop count tag) that could have been associated with Ptr<Packet>
-  //
-  // Copying of Data is relatively cheap operation, as it copies (mostly) a collection of Blocks
-  // pointing to the same underlying memory buffer.
-  shared_ptr<Data> dataCopyWithoutPacket = make_shared<Data>(data);
-  dataCopyWithoutPacket->removeTag<ns3::ndn::Ns3PacketTag>();
-
-  // CS insert
+  // Both content stores keep only the wire encoding of a cached Data, so neither Ptr<Packet>
+  // nor other tags (e.g., hop count tag) of this Data are retained, and no copy is needed.
 
   // Only insert when it's not a NACK!
   auto nackType = nfd::fw::StrHelper::getNackType(data);
@@ -350,12 +341,14 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   if (nackType <= 0) {
 
     if (m_csFromNdnSim == nullptr)
-      m_cs.insert(*dataCopyWithoutPacket);
+      m_cs.insert(data);
     else
-      m_csFromNdnSim->Add(dataCopyWithoutPacket);
+      m_csFromNdnSim->Add(data.shared_from_this());
   }
   else {
-    std::cout << "Got NACK! Don't insert into CS!\n";
+    ++m_counters.getNInNacks();
+    NFD_LOG_DEBUG("onIncomingData face=" << inFace.getId() << " data=" << data.getName()
+                  << " NACK type=" << static_cast<int>(nackType) << ", not cached");
   }
 
   std::set<shared_ptr<Face> > pendingDownstreams;
@@ -422,7 +415,7 @@ Forwarder::onDataUnsolicited(Face& inFace, const Data& data)
 }
 
 void
-Forwarder::onOutgoingData(const Data& data, Face& outFace)
+Forwarder::onOutgoingData(const Data& data, Face& outFace, const CsHit* hit)
 {
   if (outFace.getId() == INVALID_FACEID) {
     NFD_LOG_WARN("onOutgoingData face=invalid data=" << data.getName());
@@ -443,7 +436,12 @@ Forwarder::onOutgoingData(const Data& data, Face& outFace)
   // TODO traffic manager
 
   // send Data
-  outFace.sendData(data);
+  if (hit == nullptr) {
+    outFace.sendData(data);
+  }
+  else {
+    outFace.sendCachedData(data, *hit);
+  }
   ++m_counters.getNOutDatas();
 }
 
@@ -466,9 +464,8 @@ Forwarder::setUnsatisfyTimer(shared_ptr<pit::Entry> pitEntry)
     // TODO all InRecords are already expired; will this happen?
   }
 
-  scheduler::cancel(pitEntry->m_unsatisfyTimer);
-  pitEntry->m_unsatisfyTimer = scheduler::schedule(lastExpiryFromNow,
-      bind(&Forwarder::onInterestUnsatisfied, this, pitEntry));
+  pitEntry->m_unsatisfyTimer.schedule(lastExpiryFromNow,
+      &Forwarder::onInterestUnsatisfied, this, pitEntry);
 }
 
 void
@@ -478,22 +475,21 @@ Forwarder::setStragglerTimer(shared_ptr<pit::Entry> pitEntry,
 {
   time::nanoseconds stragglerTime = time::milliseconds(100);
 
-  scheduler::cancel(pitEntry->m_stragglerTimer);
-  pitEntry->m_stragglerTimer = scheduler::schedule(stragglerTime,
-      bind(&Forwarder::onInterestFinalize, this, pitEntry, isSatisfied, dataFreshnessPeriod));
+  pitEntry->m_stragglerTimer.schedule(stragglerTime,
+      &Forwarder::onInterestFinalize, this, pitEntry, isSatisfied, dataFreshnessPeriod);
 }
 
 void
 Forwarder::cancelUnsatisfyAndStragglerTimer(shared_ptr<pit::Entry> pitEntry)
 {
-  scheduler::cancel(pitEntry->m_unsatisfyTimer);
-  scheduler::cancel(pitEntry->m_stragglerTimer);
+  pitEntry->m_unsatisfyTimer.cancel();
+  pitEntry->m_stragglerTimer.cancel();
 }
 
 static inline void
 insertNonceToDnl(DeadNonceList& dnl, const pit::Entry& pitEntry, const pit::OutRecord& outRecord)
 {
-  dnl.add(pitEntry.getName(), outRecord.getLastNonce());
+  dnl.add(pitEntry.getInterest(), outRecord.getLastNonce());
 }
 
 void
@@ -529,7 +525,7 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry,
     // insert outgoing Nonce of a specific face
     pit::OutRecordCollection::const_iterator outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      m_deadNonceList.add(pitEntry.getInterest(), outRecord->getLastNonce());
     }
   }
 }
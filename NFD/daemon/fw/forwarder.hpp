@@ -205,10 +205,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   onDataUnsolicited(Face& inFace, const Data& data);
 
   /** \brief outgoing Data pipeline
+   *  \param hit per-hit state if \p data comes from the ContentStore, otherwise nullptr
    */
   VIRTUAL_WITH_TESTS
   void
-  onOutgoingData(const Data& data, Face& outFace);
+  onOutgoingData(const Data& data, Face& outFace, const CsHit* hit = nullptr);
 
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:VIRTUAL_WITH_TESTS
   void
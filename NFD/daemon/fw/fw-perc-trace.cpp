@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2016 Klaus Schneider, The University of Arizona
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Klaus Schneider <klaus@cs.arizona.edu>
+ */
+
+#include "fw-perc-trace.hpp"
+#include "str-helper.hpp"
+
+namespace nfd {
+namespace fw {
+
+const char FwPercTrace::MAGIC[4] = {'F', 'W', 'P', '1'};
+
+FwPercTrace::FwPercTrace(const std::string& fileName, Format format,
+                         uint32_t sampling, size_t capacity)
+  : m_format(format)
+  , m_sampling(std::max<uint32_t>(sampling, 1))
+  , m_nSnapshots(0)
+  , m_nWrittenPrefixes(0)
+{
+  m_buffer.reserve(std::max<size_t>(capacity, 1));
+
+  if (m_format == FORMAT_BINARY) {
+    m_os.open(fileName, std::ios::binary);
+    m_os.write(MAGIC, sizeof(MAGIC));
+  }
+  else {
+    m_os.open(fileName);
+    m_os << "Time\tNode\tPrefix\tFaceId\ttype\tvalue\n";
+  }
+}
+
+FwPercTrace::~FwPercTrace()
+{
+  flush();
+  m_os.close();
+}
+
+shared_ptr<FwPercTrace>
+FwPercTrace::createFromEnvironment()
+{
+  const char* format = getenv("FWPERC_FORMAT");
+  bool isBinary = format != nullptr && std::string(format) == "binary";
+  int sampling = StrHelper::getEnvVariable("FWPERC_SAMPLING", 1);
+  int capacity = StrHelper::getEnvVariable("FWPERC_BUFFER", 65536);
+
+  if (isBinary) {
+    return make_shared<FwPercTrace>("results/fwperc.bin", FORMAT_BINARY, sampling, capacity);
+  }
+  return make_shared<FwPercTrace>("results/fwperc.txt", FORMAT_TEXT, sampling, capacity);
+}
+
+bool
+FwPercTrace::shouldSample()
+{
+  return (m_nSnapshots++ % m_sampling) == 0;
+}
+
+void
+FwPercTrace::add(double time, uint32_t nodeId, const std::string& prefix,
+                 FaceId faceId, double fwPerc)
+{
+  Record record;
+  record.time = time;
+  record.nodeId = nodeId;
+  record.prefixId = getPrefixId(prefix);
+  record.faceId = faceId;
+  record.fwPerc = fwPerc;
+  m_buffer.push_back(record);
+
+  if (m_buffer.size() == m_buffer.capacity()) {
+    writeBuffer();
+  }
+}
+
+void
+FwPercTrace::flush()
+{
+  writeBuffer();
+  m_os.flush();
+}
+
+uint32_t
+FwPercTrace::getPrefixId(const std::string& prefix)
+{
+  auto it = m_prefixIds.find(prefix);
+  if (it != m_prefixIds.end()) {
+    return it->second;
+  }
+
+  uint32_t id = m_prefixes.size();
+  m_prefixIds.emplace(prefix, id);
+  m_prefixes.push_back(prefix);
+  return id;
+}
+
+void
+FwPercTrace::writeBuffer()
+{
+  if (m_buffer.empty()) {
+    return;
+  }
+
+  if (m_format == FORMAT_BINARY) {
+    uint32_t nNewPrefixes = m_prefixes.size() - m_nWrittenPrefixes;
+    m_os.write(reinterpret_cast<const char*>(&nNewPrefixes), sizeof(nNewPrefixes));
+    for (; m_nWrittenPrefixes < m_prefixes.size(); ++m_nWrittenPrefixes) {
+      const std::string& prefix = m_prefixes[m_nWrittenPrefixes];
+      uint32_t length = prefix.size();
+      m_os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      m_os.write(prefix.data(), length);
+    }
+
+    uint32_t nRecords = m_buffer.size();
+    m_os.write(reinterpret_cast<const char*>(&nRecords), sizeof(nRecords));
+    m_os.write(reinterpret_cast<const char*>(m_buffer.data()), nRecords * sizeof(Record));
+  }
+  else {
+    for (const Record& record : m_buffer) {
+      m_os << record.time << "\t" << record.nodeId << "\t" << m_prefixes[record.prefixId] << "\t"
+           << record.faceId << "\t" << "forwperc" << "\t" << record.fwPerc << "\n";
+    }
+  }
+
+  m_buffer.clear();
+}
+
+} // namespace fw
+} // namespace nfd
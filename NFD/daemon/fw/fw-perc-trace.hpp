@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2016 Klaus Schneider, The University of Arizona
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Klaus Schneider <klaus@cs.arizona.edu>
+ */
+
+#ifndef NFD_DAEMON_FW_FW_PERC_TRACE_HPP
+#define NFD_DAEMON_FW_FW_PERC_TRACE_HPP
+
+#include "../face/face.hpp"
+
+#include <fstream>
+
+namespace nfd {
+namespace fw {
+
+/** \brief buffered sink for the forwarding percentage log of PconStrategy
+ *
+ *  Records are appended to an in-memory buffer of fixed capacity and written out as one
+ *  block when the buffer is full, on flush() and on destruction. Nothing is formatted or
+ *  flushed on the forwarding path.
+ *
+ *  In binary format the file starts with MAGIC and consists of chunks:
+ *  \code
+ *    uint32 nNewPrefixes; { uint32 length; char prefix[length]; } * nNewPrefixes
+ *    uint32 nRecords;     Record * nRecords
+ *  \endcode
+ *  Prefix ids are assigned in order of appearance. examples/graphs/fwperc-to-csv.py turns
+ *  such a file into the table that used to be written to results/fwperc.txt.
+ *
+ *  In text format the same table is written directly (still buffered).
+ */
+class FwPercTrace : noncopyable
+{
+public:
+  enum Format {
+    FORMAT_BINARY,
+    FORMAT_TEXT
+  };
+
+  struct Record
+  {
+    double time;
+    uint32_t nodeId;
+    uint32_t prefixId;
+    uint64_t faceId;
+    double fwPerc;
+  };
+
+  static const char MAGIC[4];
+
+  /** \param fileName output file
+   *  \param format output format
+   *  \param sampling keep one of every \p sampling calls to add()
+   *  \param capacity number of records buffered before they are written out
+   */
+  FwPercTrace(const std::string& fileName, Format format,
+              uint32_t sampling = 1, size_t capacity = 65536);
+
+  ~FwPercTrace();
+
+  /** \brief create trace configured through environment variables
+   *
+   *  FWPERC_FORMAT     "text" (default, writes results/fwperc.txt) or "binary" (results/fwperc.bin)
+   *  FWPERC_SAMPLING   keep one of every n forwarding table snapshots (default 1)
+   *  FWPERC_BUFFER     number of buffered records (default 65536)
+   */
+  static shared_ptr<FwPercTrace>
+  createFromEnvironment();
+
+  /** \return true if the next snapshot should be recorded according to sampling
+   */
+  bool
+  shouldSample();
+
+  /** \brief append one forwarding percentage entry
+   */
+  void
+  add(double time, uint32_t nodeId, const std::string& prefix, FaceId faceId, double fwPerc);
+
+  /** \brief write out all buffered records
+   */
+  void
+  flush();
+
+private:
+  uint32_t
+  getPrefixId(const std::string& prefix);
+
+  void
+  writeBuffer();
+
+private:
+  std::ofstream m_os;
+  Format m_format;
+  uint32_t m_sampling;
+  uint64_t m_nSnapshots;
+
+  std::vector<Record> m_buffer;
+
+  std::unordered_map<std::string, uint32_t> m_prefixIds;
+  std::vector<std::string> m_prefixes;
+  size_t m_nWrittenPrefixes;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_FW_PERC_TRACE_HPP
@@ -24,11 +24,20 @@
 #include "../face/face.hpp"
 #include "strategy-info.hpp"
 
+#include <numeric>
+
 namespace nfd {
 namespace fw {
 
 /**
  * Measurement information that can be saved and retrieved per-name-prefix.
+ *
+ * The forwarding percentages are kept in two contiguous arrays (face ids and percentages, in
+ * order of insertion) together with their cumulative distribution, which is rebuilt lazily
+ * after a modification.  Faces are found by a linear scan, which for the handful of next hops
+ * of a prefix is cheaper than a tree lookup; weighted face selection is a binary search on the
+ * cumulative distribution, or an O(1) lookup in a cached alias table (Vose's method) for a
+ * given set of eligible faces.
  */
 class MtForwardingInfo : public StrategyInfo
 {
@@ -42,49 +51,184 @@ public:
 
   MtForwardingInfo()
       : m_ownPrefix("null")
+      , m_isCumulativeValid(true)
+      , m_nAliasTables(0)
+      , m_nextAliasTable(0)
   {
   }
 
+  /// \return forwarding percentage of \p face, or 0 if \p face is not in the table
   double
-  getforwPerc(FaceId face)
+  getforwPerc(FaceId face) const
   {
-    if (m_forwPercMap.find(face) == m_forwPercMap.end()) {
-      std::cout << time::steady_clock::now().time_since_epoch().count() / 1000 * 1000
-          << " ms, couldn't find face " << face << "\n";
+    size_t index = findIndex(face);
+    if (index == size()) {
+      return 0.0;
     }
-    assert(m_forwPercMap.find(face) != m_forwPercMap.end());
-    double forwPerc = m_forwPercMap.at(face);
+    double forwPerc = m_forwPercs[index];
     assert(forwPerc >= 0 && forwPerc <= 1);
 
     return forwPerc;
   }
 
+  /** \brief adds \p faceId with a forwarding percentage of 0, unless it is in the table
+   *  \return true if \p faceId was added
+   */
+  bool
+  addFace(FaceId faceId)
+  {
+    if (findIndex(faceId) != size()) {
+      return false;
+    }
+    setforwPerc(faceId, 0.0);
+    return true;
+  }
+
   void
   setforwPerc(FaceId faceId, double perc)
   {
-    m_forwPercMap[faceId] = perc;
+    getOrInsert(faceId) = perc;
+    invalidateSampling();
   }
 
   void
   increaseforwPerc(FaceId faceId, double changeRate)
   {
-    m_forwPercMap[faceId] += changeRate;
+    getOrInsert(faceId) += changeRate;
+    invalidateSampling();
   }
 
-  const std::map<FaceId, double>
-  getForwPercMap() const
+  /** \brief moves up to \p change of the forwarding percentage of \p faceId to the other faces
+   *
+   *  The reduction is capped at the current percentage of \p faceId and spread equally over
+   *  all other faces, so the sum of percentages stays unchanged. Nothing changes if \p faceId
+   *  is not in the table.
+   *  \pre getFaceCount() > 1
+   *  \return the sum of all forwarding percentages after the update
+   */
+  double
+  reduceforwPerc(FaceId faceId, double change)
   {
-    return m_forwPercMap;
+    size_t reducedIndex = findIndex(faceId);
+    assert(size() > 1);
+    if (reducedIndex == size()) {
+      return std::accumulate(m_forwPercs.begin(), m_forwPercs.end(), 0.0);
+    }
+
+    double reduction = std::min(change, m_forwPercs[reducedIndex]);
+    double increase = reduction / static_cast<double>(size() - 1);
+
+    double sum = 0;
+    for (size_t i = 0; i < size(); ++i) {
+      m_forwPercs[i] += (i == reducedIndex) ? -reduction : increase;
+      sum += m_forwPercs[i];
+    }
+    invalidateSampling();
+    return sum;
   }
 
   int
-  getFaceCount()
+  getFaceCount() const
+  {
+    return m_faceIds.size();
+  }
+
+  /// number of faces in the table, same as getFaceCount()
+  size_t
+  size() const
+  {
+    return m_faceIds.size();
+  }
+
+  /// \return index of \p faceId in the table, or size() if it is not there
+  size_t
+  findIndex(FaceId faceId) const
+  {
+    return std::find(m_faceIds.begin(), m_faceIds.end(), faceId) - m_faceIds.begin();
+  }
+
+  /** \brief same as findIndex(faceId), but checks index \p hint first
+   *
+   *  Faces are stored in the order they were added, which is usually the order of the FIB next
+   *  hops, so the position of a next hop is a good hint.
+   */
+  size_t
+  findIndex(FaceId faceId, size_t hint) const
   {
-    std::vector<FaceId> faceIdList;
-    for (auto faceInfo : m_forwPercMap) {
-      faceIdList.push_back(faceInfo.first);
+    if (hint < size() && m_faceIds[hint] == faceId) {
+      return hint;
+    }
+    return findIndex(faceId);
+  }
+
+  FaceId
+  getFaceIdAt(size_t index) const
+  {
+    return m_faceIds[index];
+  }
+
+  double
+  getforwPercAt(size_t index) const
+  {
+    return m_forwPercs[index];
+  }
+
+  /** \brief selects a face index with probability proportional to its forwarding percentage
+   *  \param r uniformly distributed number in [0, 1)
+   *  \pre size() > 0
+   */
+  size_t
+  selectIndex(double r) const
+  {
+    const std::vector<double>& cumulative = getCumulative();
+    size_t index = std::upper_bound(cumulative.begin(), cumulative.end(),
+                                    r * cumulative.back()) - cumulative.begin();
+    return std::min(index, size() - 1);
+  }
+
+  /** \brief selects one of \p candidates with probability proportional to its forwarding
+   *         percentage
+   *  \param r uniformly distributed number in [0, 1)
+   *  \param candidates non-empty list of table indexes, in table order
+   *  \param candidateSum sum of the forwarding percentages of \p candidates
+   */
+  size_t
+  selectIndex(double r, const std::vector<size_t>& candidates, double candidateSum) const
+  {
+    assert(!candidates.empty());
+    double threshold = r * candidateSum;
+    double sum = 0;
+    for (size_t index : candidates) {
+      sum += m_forwPercs[index];
+      if (threshold < sum) {
+        return index;
+      }
+    }
+    return candidates.back();
+  }
+
+  /** \brief selects one of the faces in \p eligibleMask with probability proportional to its
+   *         forwarding percentage
+   *
+   *  The alias table for \p eligibleMask is built on first use and kept until the forwarding
+   *  percentages change; a few tables (e.g., one per downstream excluded from the eligible set)
+   *  are cached at the same time.
+   *
+   *  \param r uniformly distributed number in [0, 1)
+   *  \param eligibleMask bit i set if the face at index i is eligible, at least one bit set
+   *  \pre size() <= MAX_MASK_FACES
+   */
+  size_t
+  sampleIndex(double r, uint64_t eligibleMask) const
+  {
+    const AliasTable& table = getAliasTable(eligibleMask);
+
+    double scaled = r * table.indices.size();
+    size_t bucket = std::min(static_cast<size_t>(scaled), table.indices.size() - 1);
+    if (scaled - bucket < table.probs[bucket]) {
+      return table.indices[bucket];
     }
-    return faceIdList.size();
+    return table.indices[table.aliases[bucket]];
   }
 
   void
@@ -99,7 +243,124 @@ public:
     return m_ownPrefix;
   }
 
+public:
+  /// largest table that can be used with sampleIndex()
+  static const size_t MAX_MASK_FACES = 64;
+
 private:
+  struct AliasTable
+  {
+    uint64_t mask;
+    std::vector<size_t> indices; ///< table indexes of the eligible faces
+    std::vector<double> probs;   ///< probability of keeping the bucket
+    std::vector<size_t> aliases; ///< bucket used otherwise
+  };
+
+  /// number of alias tables kept for different eligible sets
+  static const size_t MAX_ALIAS_TABLES = 4;
+
+  void
+  invalidateSampling()
+  {
+    m_isCumulativeValid = false;
+    m_nAliasTables = 0;
+  }
+
+  const AliasTable&
+  getAliasTable(uint64_t mask) const
+  {
+    for (size_t i = 0; i < m_nAliasTables; ++i) {
+      if (m_aliasTables[i].mask == mask) {
+        return m_aliasTables[i];
+      }
+    }
+
+    if (m_aliasTables.size() < MAX_ALIAS_TABLES) {
+      m_aliasTables.resize(MAX_ALIAS_TABLES);
+    }
+    size_t slot = m_nAliasTables;
+    if (m_nAliasTables < MAX_ALIAS_TABLES) {
+      ++m_nAliasTables;
+    }
+    else {
+      slot = m_nextAliasTable;
+      m_nextAliasTable = (m_nextAliasTable + 1) % MAX_ALIAS_TABLES;
+    }
+
+    buildAliasTable(m_aliasTables[slot], mask);
+    return m_aliasTables[slot];
+  }
+
+  /** \brief Vose's alias method; storage of \p table and of the work lists is reused
+   */
+  void
+  buildAliasTable(AliasTable& table, uint64_t mask) const
+  {
+    assert(size() <= MAX_MASK_FACES);
+    assert(mask != 0);
+
+    table.mask = mask;
+    table.indices.clear();
+    double sum = 0;
+    for (size_t i = 0; i < size(); ++i) {
+      if (mask & (uint64_t(1) << i)) {
+        table.indices.push_back(i);
+        sum += m_forwPercs[i];
+      }
+    }
+
+    size_t n = table.indices.size();
+    table.probs.resize(n);
+    table.aliases.resize(n);
+    m_small.clear();
+    m_large.clear();
+    for (size_t b = 0; b < n; ++b) {
+      table.probs[b] = (sum > 0) ? m_forwPercs[table.indices[b]] * n / sum : 1.0;
+      table.aliases[b] = b;
+      (table.probs[b] < 1.0 ? m_small : m_large).push_back(b);
+    }
+
+    while (!m_small.empty() && !m_large.empty()) {
+      size_t small = m_small.back();
+      m_small.pop_back();
+      size_t large = m_large.back();
+      table.aliases[small] = large;
+      table.probs[large] -= 1.0 - table.probs[small];
+      if (table.probs[large] < 1.0) {
+        m_large.pop_back();
+        m_small.push_back(large);
+      }
+    }
+    // leftovers are 1 up to rounding errors
+    for (size_t b : m_small) {
+      table.probs[b] = 1.0;
+    }
+    for (size_t b : m_large) {
+      table.probs[b] = 1.0;
+    }
+  }
+
+  double&
+  getOrInsert(FaceId faceId)
+  {
+    size_t index = findIndex(faceId);
+    if (index == size()) {
+      m_faceIds.push_back(faceId);
+      m_forwPercs.push_back(0.0);
+    }
+    return m_forwPercs[index];
+  }
+
+  const std::vector<double>&
+  getCumulative() const
+  {
+    if (!m_isCumulativeValid) {
+      m_cumulative.resize(m_forwPercs.size());
+      std::partial_sum(m_forwPercs.begin(), m_forwPercs.end(), m_cumulative.begin());
+      m_isCumulativeValid = true;
+    }
+    return m_cumulative;
+  }
 
   /** These Functions were used to disable faces in the "highly congested" state:*/
   //  void
@@ -122,7 +383,16 @@ private:
   //    return !disabled;
   //  }
   std::string m_ownPrefix;
-  std::map<FaceId, double> m_forwPercMap;
+  std::vector<FaceId> m_faceIds;
+  std::vector<double> m_forwPercs;
+  mutable std::vector<double> m_cumulative;
+  mutable bool m_isCumulativeValid;
+
+  mutable std::vector<AliasTable> m_aliasTables;
+  mutable size_t m_nAliasTables; ///< number of valid entries in m_aliasTables
+  mutable size_t m_nextAliasTable; ///< entry replaced when all are in use
+  mutable std::vector<size_t> m_small;
+  mutable std::vector<size_t> m_large;
 
   std::unordered_set<FaceId> m_disabledFaces;
 
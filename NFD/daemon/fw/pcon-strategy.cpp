@@ -22,6 +22,7 @@
 
 #include "str-helper.hpp"
 #include "forwarder.hpp"
+#include "core/logger.hpp"
 #include "../../common.hpp"
 #include "../../../model/ndn-ns3.hpp"
 #include "../../../ndn-cxx/src/util/face-uri.hpp"
@@ -29,13 +30,14 @@
 namespace nfd {
 namespace fw {
 
+NFD_LOG_INIT("PconStrategy");
+
 const Name PconStrategy::STRATEGY_NAME(
     "ndn:/localhost/nfd/strategy/pcon-strategy/%FD%01");
 NFD_REGISTER_STRATEGY(PconStrategy);
 
 // Used for logging:
-shared_ptr<std::ofstream> PconStrategy::m_os;
-boost::mutex PconStrategy::m_mutex;
+shared_ptr<FwPercTrace> PconStrategy::m_fwPercTrace;
 
 PconStrategy::PconStrategy(Forwarder& forwarder, const Name& name)
     : Strategy(forwarder, name),
@@ -43,16 +45,14 @@ PconStrategy::PconStrategy(Forwarder& forwarder, const Name& name)
         m_lastFWRatioUpdate(time::steady_clock::TimePoint::min()),
         m_lastFWWrite(time::steady_clock::TimePoint::min()),
         sharedInfo(make_shared<MtForwardingInfo>()),
+        m_random(ns3::CreateObject<ns3::UniformRandomVariable>()),
         TIME_BETWEEN_FW_UPDATE(time::milliseconds(110)),
         // 20ms between each writing of the forwarding table
         TIME_BETWEEN_FW_WRITE(time::milliseconds(20))
 {
-  // Write header of forwarding percentage table
-  if (m_os == nullptr) {
-    m_os = make_shared<std::ofstream>();
-    m_os->open("results/fwperc.txt");
-    *m_os << "Time" << "\tNode" << "\tPrefix" << "\tFaceId" << "\ttype" << "\tvalue"
-        << "\n";
+  // Open forwarding percentage table (shared by all nodes)
+  if (m_fwPercTrace == nullptr) {
+    m_fwPercTrace = FwPercTrace::createFromEnvironment();
   }
 
   // Start all FIB entries by sending on the shortest path? 
@@ -68,7 +68,7 @@ PconStrategy::PconStrategy(Forwarder& forwarder, const Name& name)
 
 PconStrategy::~PconStrategy()
 {
-  m_os->close();
+  m_fwPercTrace->flush();
 }
 
 void
@@ -120,50 +120,79 @@ PconStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
   shared_ptr<Face> outFace = nullptr;
 
   // Random number between 0 and 1.
-  double r = ((double) rand() / (RAND_MAX));
+  double r = m_random->GetValue();
+
+  // Next hops added to the FIB after the table was initialized (e.g., by a routing update)
+  // start without any share of the traffic
+  for (const auto& n : fibEntry->getNextHops()) {
+    if (measurementInfo->addFace(n.getFace()->getId())) {
+      NFD_LOG_DEBUG("node " << m_ownForwarder.getNodeId() << " added face "
+          << n.getFace()->getId() << " to the forwarding table of " << fibEntry->getPrefix());
+    }
+  }
 
   double percSum = 0;
-  // Add all eligbile faces to list (excludes current downstream)
-  std::vector<shared_ptr<Face>> eligbleFaces;
-  for (auto n : fibEntry->getNextHops()) {
+  // Collect all eligbile faces (excludes current downstream)
+  size_t nEligible = 0;
+  uint64_t eligibleMask = 0;
+  bool useMask = measurementInfo->size() <= MtForwardingInfo::MAX_MASK_FACES;
+  m_eligibleIndices.clear();
+  size_t position = 0;
+  for (const auto& n : fibEntry->getNextHops()) {
+    ++position;
     if (StrHelper::predicate_NextHop_eligible(pitEntry, n, inFace.getId())) {
-      eligbleFaces.push_back(n.getFace());
+      size_t index = measurementInfo->findIndex(n.getFace()->getId(), position - 1);
+      assert(index < measurementInfo->size());
+      if (useMask && index < MtForwardingInfo::MAX_MASK_FACES) {
+        eligibleMask |= uint64_t(1) << index;
+      }
+      m_eligibleIndices.push_back(index);
+      if (nEligible++ == 0) {
+        outFace = n.getFace();
+      }
       // Add up percentage Sum.
-      percSum += measurementInfo->getforwPerc(n.getFace()->getId());
+      percSum += measurementInfo->getforwPercAt(index);
     }
   }
 
-  if (eligbleFaces.size() < 1) {
-    std::cout << "Blocked interest from face: " << inFace.getId()
-        << " (no eligible faces)\n";
+  if (nEligible < 1) {
+    ++this->getCounters().getNBlockedInterests();
+    NFD_LOG_DEBUG("Blocked interest " << interest.getName() << " from face: " << inFace.getId()
+        << " (no eligible faces)");
     return;
   }
 
-  // If only one face: Send out on it.
-  else if (eligbleFaces.size() == 1) {
-    outFace = eligbleFaces.front();
-  }
+  // If only one face: Send out on it (outFace is already set).
 
   // More than 1 eligible face!
-  else {
-    // If percSum == 0, there is likely a problem in the routing configuration,
-    // e.g. only the downstream has a forwPerc > 0.
-    assert(percSum > 0);
-
+  else if (nEligible > 1) {
     // Write fw percentage to file
     if (time::steady_clock::now() >= m_lastFWWrite + TIME_BETWEEN_FW_WRITE) {
       m_lastFWWrite = time::steady_clock::now();
       writeFwPercMap(m_ownForwarder, measurementInfo);
     }
 
-    // Choose face according to current forwarding percentage:
-    double forwPerc = 0;
-    for (auto face : eligbleFaces) {
-      forwPerc += measurementInfo->getforwPerc(face->getId()) / percSum;
-      assert(forwPerc >= 0);
-      assert(forwPerc <= 1.1);
-      if (r < forwPerc) {
-        outFace = face;
+    // Choose face according to current forwarding percentage, using the alias table cached
+    // for this set of eligible faces.
+    // percSum == 0 if the whole share is on faces that are not eligible, e.g. on the
+    // downstream or on next hops removed from the FIB: split equally then.
+    size_t outIndex;
+    if (percSum <= 0) {
+      outIndex = m_eligibleIndices[std::min(static_cast<size_t>(r * nEligible), nEligible - 1)];
+    }
+    else if (useMask) {
+      outIndex = measurementInfo->sampleIndex(r, eligibleMask);
+    }
+    else {
+      std::sort(m_eligibleIndices.begin(), m_eligibleIndices.end());
+      outIndex = measurementInfo->selectIndex(r, m_eligibleIndices, percSum);
+    }
+
+    FaceId outFaceId = measurementInfo->getFaceIdAt(outIndex);
+    outFace = nullptr;
+    for (const auto& n : fibEntry->getNextHops()) {
+      if (n.getFace()->getId() == outFaceId) {
+        outFace = n.getFace();
         break;
       }
     }
@@ -178,12 +207,13 @@ PconStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
   assert(outFace != nullptr);
 
   // If outgoing face is congested: mark PIT entry as congested. 
-  if (StrHelper::isCongested(m_ownForwarder, outFace->getId())) {
+  if (outFace->isCongested()) {
     pitEntry->m_congMark = true;
     // TODO: Reduce forwarding percentage on outgoing face? 
-    std::cout << StrHelper::getTime() << " node " << m_ownForwarder.getNodeId()
-        << " marking PIT Entry " << pitEntry->getName() << ", inface: " << inFace.getId()
-        << ", outface: " << outFace->getId() << "\n";
+    ++this->getCounters().getNPitCongestionMarks();
+    NFD_LOG_DEBUG("node " << m_ownForwarder.getNodeId() << " marking PIT Entry "
+        << pitEntry->getName() << ", inface: " << inFace.getId() << ", outface: "
+        << outFace->getId());
   }
 
   this->sendInterest(pitEntry, outFace, wantNewNonce);
@@ -212,7 +242,26 @@ void
 PconStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry, const Face& inFace,
     const Data& data)
 {
+  shared_ptr<ndn::CongestionTag> tag = processSatisfyingData(pitEntry, inFace, data);
+  if (tag != nullptr) {
+    data.setTag(tag);
+  }
+}
+
+/**
+ * The cached Data is shared by all hits, so the mark of this hit goes to hit.
+ */
+void
+PconStrategy::beforeSatisfyInterestFromCs(shared_ptr<pit::Entry> pitEntry, const Face& inFace,
+    const Data& data, CsHit& hit)
+{
+  hit.congestionTag = processSatisfyingData(pitEntry, inFace, data);
+}
 
+shared_ptr<ndn::CongestionTag>
+PconStrategy::processSatisfyingData(shared_ptr<pit::Entry> pitEntry, const Face& inFace,
+    const Data& data)
+{
   Name currentPrefix;
   shared_ptr<MtForwardingInfo> measurementInfo;
   std::tie(currentPrefix, measurementInfo) = StrHelper::findPrefixMeasurementsLPM(
@@ -252,15 +301,14 @@ PconStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry, const Face&
 
   bool pitMarkedCongested = false;
   if (pitEntry->m_congMark == true) {
-    std::cout << StrHelper::getTime() << " node " << m_ownForwarder.getNodeId()
-        << " found marked PIT Entry: " << pitEntry->getName() << ", face: "
-        << inFace.getId() << "!\n";
+    NFD_LOG_DEBUG("node " << m_ownForwarder.getNodeId() << " found marked PIT Entry: "
+        << pitEntry->getName() << ", face: " << inFace.getId());
     pitMarkedCongested = true;
   }
 
+  shared_ptr<ndn::CongestionTag> tag;
   for (auto n : pitEntry->getInRecords()) {
-    bool downStreamCongested = StrHelper::isCongested(m_ownForwarder,
-        n.getFace()->getId());
+    bool downStreamCongested = n.getFace()->isCongested();
 
     int8_t markSentPacket = std::max(
         std::max((int8_t) congMark, (int8_t) downStreamCongested),
@@ -270,9 +318,10 @@ PconStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry, const Face&
     //    tag3.setCongMark(markSentPacket);
     assert(tag3.getCongMark() == markSentPacket);
 
-    data.setTag(make_shared<ndn::CongestionTag>(tag3));
+    tag = make_shared<ndn::CongestionTag>(tag3);
   }
 
+  return tag;
 }
 
 /**
@@ -296,8 +345,8 @@ PconStrategy::beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry)
         && measurementInfo->getforwPerc(
             pitEntry->getOutRecords().front().getFace()->getId()) > 0.0) {
 
-      std::cout << StrHelper::getTime() << " PIT Timeout : " << pitEntry->getName()
-          << ", " << o.getFace()->getLocalUri() << o.getFace()->getId() << "! \n";
+      NFD_LOG_DEBUG("PIT Timeout : " << pitEntry->getName() << ", "
+          << o.getFace()->getLocalUri() << o.getFace()->getId());
 
       StrHelper::reduceFwPerc(measurementInfo,
           pitEntry->getOutRecords().front().getFace()->getId(), CHANGE_PER_MARK);
@@ -348,14 +397,17 @@ void
 PconStrategy::writeFwPercMap(Forwarder& ownForwarder,
     shared_ptr<MtForwardingInfo> measurementInfo)
 {
-  boost::mutex::scoped_lock scoped_lock(m_mutex);
-  std::string prefix = measurementInfo->getPrefix();
+  if (!m_fwPercTrace->shouldSample()) {
+    return;
+  }
+
+  double now = ns3::Simulator::Now().ToDouble(ns3::Time::S);
+  const std::string& prefix = measurementInfo->getPrefix();
 
-  for (auto f : measurementInfo->getForwPercMap()) {
-    StrHelper::printFwPerc(m_os, ownForwarder.getNodeId(), prefix, f.first, "forwperc",
-        f.second);
+  for (size_t i = 0; i < measurementInfo->size(); ++i) {
+    m_fwPercTrace->add(now, ownForwarder.getNodeId(), prefix, measurementInfo->getFaceIdAt(i),
+                       measurementInfo->getforwPercAt(i));
   }
-  m_os->flush();
 }
 
 } // namespace fw
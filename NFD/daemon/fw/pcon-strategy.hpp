@@ -23,8 +23,9 @@
 
 #include "strategy.hpp"
 #include "mt-forwarding-info.hpp"
-#include <boost/thread/pthread/mutex.hpp>
-#include <fstream>
+#include "fw-perc-trace.hpp"
+
+#include "ns3/random-variable-stream.h"
 
 namespace nfd {
 namespace fw {
@@ -49,6 +50,10 @@ public:
   beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry, const Face& inFace,
       const Data& data) DECL_OVERRIDE;
 
+  virtual void
+  beforeSatisfyInterestFromCs(shared_ptr<pit::Entry> pitEntry, const Face& inFace,
+      const Data& data, CsHit& hit) DECL_OVERRIDE;
+
   virtual void
   beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
 
@@ -65,6 +70,13 @@ public:
 
 private:
 
+  /**
+   * Adapts the forwarding percentages to the congestion mark of a satisfying Data and returns
+   * the mark for the Data sent downstream, or nullptr if there is no downstream.
+   */
+  shared_ptr<ndn::CongestionTag>
+  processSatisfyingData(shared_ptr<pit::Entry> pitEntry, const Face& inFace, const Data& data);
+
   void
   printQueue();
   int
@@ -85,8 +97,7 @@ public:
 
 private:
 
-  static shared_ptr<std::ofstream> m_os;
-  static boost::mutex m_mutex;
+  static shared_ptr<FwPercTrace> m_fwPercTrace;
 
   Forwarder& m_ownForwarder;
   time::steady_clock::TimePoint m_lastFWRatioUpdate;
@@ -100,6 +111,12 @@ private:
 
   shared_ptr<MtForwardingInfo> sharedInfo;
 
+  // per-node random stream, so that face selection follows ns-3 RngSeed/RngRun
+  ns3::Ptr<ns3::UniformRandomVariable> m_random;
+
+  // scratch space of afterReceiveInterest for tables larger than MAX_MASK_FACES
+  std::vector<size_t> m_eligibleIndices;
+
   const time::steady_clock::duration TIME_BETWEEN_FW_UPDATE;
   const time::steady_clock::duration TIME_BETWEEN_FW_WRITE;
 };
@@ -25,8 +25,6 @@
 #include "../../../utils/ndn-ns3-packet-tag.hpp"
 #include "../../../utils/ndn-ns3-cc-tag.hpp"
 #include "../../../../core/model/ptr.h"
-#include "../../../../internet/model/codel-queue2.h"
-#include "../../../../point-to-point/model/point-to-point-net-device.h"
 #include "../../../model/ndn-net-device-face.hpp"
 #include "mt-forwarding-info.hpp"
 
@@ -54,27 +52,8 @@ public:
     }
 
     // Reduction is at most the current forwarding percentage of the face that is reduced.
-    double changeRate = 0 - std::min(change, forwInfo->getforwPerc(reducedFaceId));
-
-    // Decrease fw percentage of the given face:
-    forwInfo->increaseforwPerc(reducedFaceId, changeRate);
-    double sumFWPerc = 0;
-    sumFWPerc += forwInfo->getforwPerc(reducedFaceId);
-    const auto forwMap = forwInfo->getForwPercMap();
-
-//		std::cout << "\n";
-    for (auto f : forwMap) {
-      auto tempChangeRate = changeRate;
-      auto &faceId = f.first;
-      if (faceId == reducedFaceId) { // Do nothing. Percentage has already been added.
-      }
-      else {
-        // Increase forwarding percentage of all other faces by and equal amount.
-        tempChangeRate = std::abs(changeRate / (double) (forwMap.size() - 1));
-        forwInfo->increaseforwPerc((faceId), tempChangeRate);
-        sumFWPerc += forwInfo->getforwPerc(faceId);
-      }
-    }
+    // The reduced amount is spread equally over all other faces.
+    double sumFWPerc = forwInfo->reduceforwPerc(reducedFaceId, change);
 
     if (sumFWPerc < 0.999 || sumFWPerc > 1.001) {
       std::cout << StrHelper::getTime() << "ERROR! Sum of fw perc out of range: " << sumFWPerc
@@ -144,32 +123,15 @@ public:
   }
 
 
-  static shared_ptr<ns3::ndn::Ns3CCTag>
+  /**
+   * Congestion tag of the received packet, decoded once at face ingress (see Ns3PacketTag).
+   */
+  static const ns3::ndn::Ns3CCTag*
   getCCTag(const ::ndn::TagHost& packet)
   {
     auto tag = packet.getTag<ns3::ndn::Ns3PacketTag>();
     if (tag != nullptr) {
-      ns3::Ptr<const ns3::Packet> pkt = tag->getPacket();
-      ns3::ndn::Ns3CCTag tempTag;  
-      bool hasTag = pkt->PeekPacketTag(tempTag);
-//      std::cout << "Has CC Tag? " << hasTag << "\n";
-      shared_ptr<ns3::ndn::Ns3CCTag> ns3ccTag = make_shared<ns3::ndn::Ns3CCTag>();
-      if (hasTag) {
-        auto it = pkt->GetPacketTagIterator();
-        int i = 0;
-        while (it.HasNext()) {
-          i++;
-          auto n = it.Next();
-          if (n.GetTypeId() == ns3::ndn::Ns3CCTag::GetTypeId()) {
-            n.GetTag(*ns3ccTag);
-            break;
-          }
-        }
-        return ns3ccTag;
-      }
-      else {
-        return nullptr;
-      }
+      return tag->getCCTag();
     }
     return nullptr;
   }
@@ -218,55 +180,6 @@ public:
     return me->getOrCreateStrategyInfo<MtForwardingInfo>();
   }
 
-  /**
-   * Returns true if packet should be marked according to CoDel logic.
-   */
-  static bool
-  isCongested(Forwarder& forwarder, int faceid)
-  {
-    auto codelQueue = getCodelQueue(forwarder, faceid);
-
-    if (codelQueue != nullptr) {
-      //        std::cout << "Got CodelQueue!\n";
-      //        std::cout << "Codel dropping state: " << codelQueue->isInDroppingState() << "\n";
-      bool shouildBeMarked = codelQueue->isOkToMark();
-      return shouildBeMarked;
-    }
-    // Error
-    return false;
-  }
-
-  /**
-   * Returns true if the queue size is over thresholdPerc or the CoDel queuing delay is over thresholdDelayInMs
-   */
-  static bool
-  isHighlyCongested(Forwarder& forwarder,
-      int faceid,
-      double thresholdPerc = 0.9,
-      double thresholdDelayInMs = 1000)
-  {
-    auto codelQueue = getCodelQueue(forwarder, faceid);
-    if (codelQueue != nullptr) {
-
-      // Queue fuller than threshold, default: 90%! 
-      bool queueAlmostFull = codelQueue->isQueueOverLimit(thresholdPerc);
-      int64_t timeOverLimitNano = codelQueue->getTimeOverLimitInNS();
-      double timeOverMS = (double) timeOverLimitNano / (1000 * 1000);
-
-      // Set as highly congested if queuing delay over thresholdDelayInMs (default 1s) 
-      // or queue over thresholdPerc:
-      if (timeOverMS > thresholdDelayInMs || queueAlmostFull) {
-//      std::cout << "StrHelper: Queue over high threshold!\n";
-        return true;
-      }
-      else {
-        return false;
-      }
-    }
-    // Error
-    return false;
-  }
-
   static std::string
   getTime()
   {
@@ -334,43 +247,10 @@ private:
     return val == NULL ? std::string() : std::string(val);
   }
 
-  static ns3::Ptr<ns3::CoDelQueue2>
-  getCodelQueue(Forwarder& forwarder, int faceid)
-  {
-    shared_ptr<Face> face = forwarder.getFace(faceid);
-    shared_ptr<ns3::ndn::NetDeviceFace> netDeviceFace = std::dynamic_pointer_cast<
-        ns3::ndn::NetDeviceFace>(face);
-    if (netDeviceFace == nullptr || netDeviceFace == 0) {
-      // do nothing
-    }
-    else {
-      ns3::Ptr<ns3::NetDevice> netdevice { netDeviceFace->GetNetDevice() };
-
-      if (netdevice == nullptr) {
-        std::cout << "Netdev nullptr!\n";
-      }
- 
-      ns3::Ptr<ns3::PointToPointNetDevice> ptp = ns3::DynamicCast<ns3::PointToPointNetDevice>(
-          netdevice);
- 
-      if (ptp == nullptr) {
-        std::cout << "Not a PointToPointNetDevice\n";
-      }
-      else {
-        auto q = ptp->GetQueue();  
-        auto codelQueue = ns3::DynamicCast<ns3::CoDelQueue2>(q);
-        return codelQueue;
-      }
-    }
-    // Error
-    return nullptr;
-  }
-  
-
   static bool
   getHighCongMark(const ::ndn::TagHost& packet)
   { 
-    shared_ptr<ns3::ndn::Ns3CCTag> tag = getCCTag(packet);
+    auto tag = getCCTag(packet);
     if (tag != nullptr) {
       return tag->getHighCongMark();
     }
@@ -54,6 +54,13 @@ Strategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
     " inFace=" << inFace.getId() << " data=" << data.getName());
 }
 
+void
+Strategy::beforeSatisfyInterestFromCs(shared_ptr<pit::Entry> pitEntry,
+                                      const Face& inFace, const Data& data, CsHit& hit)
+{
+  this->beforeSatisfyInterest(pitEntry, inFace, data);
+}
+
 void
 Strategy::beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry)
 {
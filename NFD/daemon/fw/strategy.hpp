@@ -96,6 +96,17 @@ public: // triggers
   beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                         const Face& inFace, const Data& data);
 
+  /** \brief trigger before PIT entry is satisfied by a Data from the ContentStore
+   *
+   *  The Data is shared by all hits on its ContentStore entry and must not be modified.
+   *  State that belongs to this hit, such as a congestion mark, is set on \p hit instead.
+   *
+   *  In this base class this method calls beforeSatisfyInterest.
+   */
+  virtual void
+  beforeSatisfyInterestFromCs(shared_ptr<pit::Entry> pitEntry,
+                              const Face& inFace, const Data& data, CsHit& hit);
+
   /** \brief trigger before PIT entry expires
    *
    *  PIT entry expires when InterestLifetime has elapsed for all InRecords,
@@ -136,6 +147,10 @@ protected: // accessors
   const FaceTable&
   getFaceTable();
 
+  /// forwarder counters, used to report strategy events (e.g., blocked Interests)
+  ForwarderCounters&
+  getCounters();
+
 protected: // accessors
   signal::Signal<FaceTable, shared_ptr<Face>>& afterAddFace;
   signal::Signal<FaceTable, shared_ptr<Face>>& beforeRemoveFace;
@@ -169,7 +184,6 @@ Strategy::sendInterest(shared_ptr<pit::Entry> pitEntry,
 inline void
 Strategy::rejectPendingInterest(shared_ptr<pit::Entry> pitEntry)
 {
-  std::cout << "Rejected pending Interests\n";
   m_forwarder.onInterestReject(pitEntry);
 }
 
@@ -191,6 +205,12 @@ Strategy::getFaceTable()
   return m_forwarder.getFaceTable();
 }
 
+inline ForwarderCounters&
+Strategy::getCounters()
+{
+  return m_forwarder.m_counters;
+}
+
 } // namespace fw
 } // namespace nfd
 
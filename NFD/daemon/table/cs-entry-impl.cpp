@@ -34,7 +34,7 @@ EntryImpl::EntryImpl(const Name& name)
   BOOST_ASSERT(this->isQuery());
 }
 
-EntryImpl::EntryImpl(shared_ptr<const Data> data, bool isUnsolicited)
+EntryImpl::EntryImpl(const Data& data, bool isUnsolicited)
 {
   this->setData(data, isUnsolicited);
   BOOST_ASSERT(!this->isQuery());
@@ -57,11 +57,11 @@ void
 EntryImpl::unsetUnsolicited()
 {
   BOOST_ASSERT(!this->isQuery());
-  this->setData(this->getData(), false);
+  this->setUnsolicited(false);
 }
 
 int
-compareQueryWithData(const Name& queryName, const Data& data)
+compareQueryWithData(const Name& queryName, const Entry& data)
 {
   bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
 
@@ -82,7 +82,7 @@ compareQueryWithData(const Name& queryName, const Data& data)
 }
 
 int
-compareDataWithData(const Data& lhs, const Data& rhs)
+compareDataWithData(const Entry& lhs, const Entry& rhs)
 {
   int cmp = lhs.getName().compare(rhs.getName());
   if (cmp != 0) {
@@ -100,15 +100,15 @@ EntryImpl::operator<(const EntryImpl& other) const
       return m_queryName < other.m_queryName;
     }
     else {
-      return compareQueryWithData(m_queryName, other.getData()) < 0;
+      return compareQueryWithData(m_queryName, other) < 0;
     }
   }
   else {
     if (other.isQuery()) {
-      return compareQueryWithData(other.m_queryName, this->getData()) > 0;
+      return compareQueryWithData(other.m_queryName, *this) > 0;
     }
     else {
-      return compareDataWithData(this->getData(), other.getData()) < 0;
+      return compareDataWithData(*this, other) < 0;
     }
   }
 }
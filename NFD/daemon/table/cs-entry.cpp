@@ -25,18 +25,43 @@
 
 #include "cs-entry.hpp"
 
+#include <ndn-cxx/util/crypto.hpp>
+
 namespace nfd {
 namespace cs {
 
 void
-Entry::setData(shared_ptr<const Data> data, bool isUnsolicited)
+Entry::setData(const Data& data, bool isUnsolicited)
 {
-  m_data = data;
+  const Block& wire = data.wireEncode();
+  m_wire = Block(wire.getBuffer(), wire.type(), wire.begin(), wire.end(),
+                 wire.value_begin(), wire.value_end());
+  m_name = data.getName();
+  m_fullName.clear();
+  m_freshnessPeriod = data.getFreshnessPeriod();
   m_isUnsolicited = isUnsolicited;
 
   updateStaleTime();
 }
 
+shared_ptr<const Data>
+Entry::getData() const
+{
+  BOOST_ASSERT(this->hasData());
+  return make_shared<Data>(m_wire);
+}
+
+const Name&
+Entry::getFullName() const
+{
+  BOOST_ASSERT(this->hasData());
+  if (m_fullName.empty()) {
+    m_fullName = m_name;
+    m_fullName.appendImplicitSha256Digest(ndn::crypto::sha256(m_wire.wire(), m_wire.size()));
+  }
+  return m_fullName;
+}
+
 bool
 Entry::isStale() const
 {
@@ -48,8 +73,8 @@ void
 Entry::updateStaleTime()
 {
   BOOST_ASSERT(this->hasData());
-  if (m_data->getFreshnessPeriod() >= time::milliseconds::zero()) {
-    m_staleTime = time::steady_clock::now() + time::milliseconds(m_data->getFreshnessPeriod());
+  if (m_freshnessPeriod >= time::milliseconds::zero()) {
+    m_staleTime = time::steady_clock::now() + m_freshnessPeriod;
   }
   else {
     m_staleTime = time::steady_clock::TimePoint::max();
@@ -60,7 +85,13 @@ bool
 Entry::canSatisfy(const Interest& interest) const
 {
   BOOST_ASSERT(this->hasData());
-  if (!interest.matchesData(*m_data)) {
+  if (!interest.getPublisherPublicKeyLocator().empty()) {
+    // the KeyLocator is only available in the wire encoding
+    if (!interest.matchesData(*this->getData())) {
+      return false;
+    }
+  }
+  else if (!this->matchesName(interest)) {
     return false;
   }
 
@@ -71,10 +102,51 @@ Entry::canSatisfy(const Interest& interest) const
   return true;
 }
 
+bool
+Entry::matchesName(const Interest& interest) const
+{
+  // same checks as Interest::matchesData, on the stored Name
+  const Name& interestName = interest.getName();
+  size_t interestNameLength = interestName.size();
+  size_t fullNameLength = m_name.size() + 1;
+
+  size_t minSuffixComponents = std::max(interest.getMinSuffixComponents(), 0);
+  if (interestNameLength + minSuffixComponents > fullNameLength) {
+    return false;
+  }
+
+  int maxSuffixComponents = interest.getMaxSuffixComponents();
+  if (maxSuffixComponents >= 0 && interestNameLength + maxSuffixComponents < fullNameLength) {
+    return false;
+  }
+
+  if (interestNameLength == fullNameLength) {
+    // only a full Name can match, and Exclude cannot be violated
+    return interestName.get(-1).isImplicitSha256Digest() && interestName == this->getFullName();
+  }
+
+  if (!interestName.isPrefixOf(m_name)) {
+    return false;
+  }
+
+  const Exclude& exclude = interest.getExclude();
+  if (exclude.empty()) {
+    return true;
+  }
+  if (interestNameLength == m_name.size()) {
+    // component to exclude is the digest
+    return !exclude.isExcluded(this->getFullName().get(-1));
+  }
+  return !exclude.isExcluded(m_name.get(interestNameLength));
+}
+
 void
 Entry::reset()
 {
-  m_data.reset();
+  m_wire = Block();
+  m_name.clear();
+  m_fullName.clear();
+  m_freshnessPeriod = time::milliseconds(-1);
   m_isUnsolicited = false;
   m_staleTime = time::steady_clock::TimePoint();
 }
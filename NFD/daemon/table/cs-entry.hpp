@@ -32,19 +32,21 @@ namespace nfd {
 namespace cs {
 
 /** \brief represents a base class for CS entry
+ *
+ *  An Entry keeps the wire encoding of the stored Data and the fields that lookups and
+ *  replacement policies need (Name, FreshnessPeriod, stale time), but not the decoded Data
+ *  packet, whose MetaInfo, Signature and parsed sub-elements would stay resident otherwise.
+ *  The Data is decoded again on demand, e.g. when a lookup returns it.
  */
 class Entry
 {
 public: // exposed through ContentStore enumeration
-  /** \return the stored Data
+  /** \return the stored Data, decoded from its wire encoding
    *  \pre hasData()
+   *  \note Every call decodes a new Data packet.
    */
-  const Data&
-  getData() const
-  {
-    BOOST_ASSERT(this->hasData());
-    return *m_data;
-  }
+  shared_ptr<const Data>
+  getData() const;
 
   /** \return Name of the stored Data
    *  \pre hasData()
@@ -53,17 +55,25 @@ public: // exposed through ContentStore enumeration
   getName() const
   {
     BOOST_ASSERT(this->hasData());
-    return m_data->getName();
+    return m_name;
   }
 
   /** \return full name (including implicit digest) of the stored Data
    *  \pre hasData()
+   *  \note The digest is computed from the wire encoding on first use and kept until the
+   *        stored Data is replaced.
    */
   const Name&
-  getFullName() const
+  getFullName() const;
+
+  /** \return FreshnessPeriod of the stored Data
+   *  \pre hasData()
+   */
+  const time::milliseconds&
+  getFreshnessPeriod() const
   {
     BOOST_ASSERT(this->hasData());
-    return m_data->getFullName();
+    return m_freshnessPeriod;
   }
 
   /** \return whether the stored Data is unsolicited
@@ -106,20 +116,21 @@ public: // used by generic ContentStore implementation
   bool
   hasData() const
   {
-    return m_data != nullptr;
+    return m_wire.hasWire();
   }
 
   /** \brief replaces the stored Data
+   *  \details Only the wire encoding of \p data is kept, which shares its buffer.
    */
   void
-  setData(shared_ptr<const Data> data, bool isUnsolicited);
+  setData(const Data& data, bool isUnsolicited);
 
   /** \brief replaces the stored Data
    */
   void
-  setData(const Data& data, bool isUnsolicited)
+  setData(shared_ptr<const Data> data, bool isUnsolicited)
   {
-    this->setData(data.shared_from_this(), isUnsolicited);
+    this->setData(*data, isUnsolicited);
   }
 
   /** \brief refreshes stale time relative to current time
@@ -133,8 +144,25 @@ public: // used by generic ContentStore implementation
   void
   reset();
 
+protected:
+  void
+  setUnsolicited(bool isUnsolicited)
+  {
+    m_isUnsolicited = isUnsolicited;
+  }
+
+private:
+  /** \brief determines whether Interest Name and selectors, except
+   *         PublisherPublicKeyLocator, match the stored Data
+   */
+  bool
+  matchesName(const Interest& interest) const;
+
 private:
-  shared_ptr<const Data> m_data;
+  Block m_wire; ///< Data wire encoding, not parsed
+  Name m_name;
+  mutable Name m_fullName; ///< Name with implicit digest, empty until getFullName()
+  time::milliseconds m_freshnessPeriod;
   bool m_isUnsolicited;
   time::steady_clock::TimePoint m_staleTime;
 };
@@ -112,7 +112,7 @@ PriorityFifoPolicy::attachQueue(iterator i)
     entryInfo->queueType = QUEUE_FIFO;
 
     if (i->canStale()) {
-      entryInfo->moveStaleEventId = scheduler::schedule(i->getData().getFreshnessPeriod(),
+      entryInfo->moveStaleEventId = scheduler::schedule(i->getFreshnessPeriod(),
                                               bind(&PriorityFifoPolicy::moveToStaleQueue, this, i));
     }
   }
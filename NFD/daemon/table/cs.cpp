@@ -25,6 +25,7 @@
 
 #include "cs.hpp"
 #include "cs-policy-priority-fifo.hpp"
+#include "name-tree.hpp"
 #include "core/logger.hpp"
 #include "core/algorithm.hpp"
 
@@ -50,7 +51,10 @@ makeDefaultPolicy()
   return unique_ptr<Policy>(new PriorityFifoPolicy());
 }
 
-Cs::Cs(size_t nMaxPackets, unique_ptr<Policy> policy)
+bool Cs::s_shouldUseHashIndexDefault = false;
+
+Cs::Cs(size_t nMaxPackets, unique_ptr<Policy> policy, bool shouldUseHashIndex)
+  : m_shouldUseHashIndex(shouldUseHashIndex)
 {
   this->setPolicyImpl(policy);
   m_policy->setLimit(nMaxPackets);
@@ -96,7 +100,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
   bool isNewEntry = false;
   iterator it;
   // use .insert because gcc46 does not support .emplace
-  std::tie(it, isNewEntry) = m_table.insert(EntryImpl(data.shared_from_this(), isUnsolicited));
+  std::tie(it, isNewEntry) = m_table.insert(EntryImpl(data, isUnsolicited));
   EntryImpl& entry = const_cast<EntryImpl&>(*it);
 
   entry.updateStaleTime();
@@ -110,6 +114,9 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    if (m_shouldUseHashIndex) {
+      this->addToHashIndex(it, name_tree::getHashSet(data));
+    }
     m_policy->afterInsert(it);
   }
 
@@ -124,9 +131,28 @@ Cs::find(const Interest& interest,
   BOOST_ASSERT(static_cast<bool>(hitCallback));
   BOOST_ASSERT(static_cast<bool>(missCallback));
 
+  bool isRightmost = interest.getChildSelector() == 1;
+  NFD_LOG_DEBUG("find " << interest.getName() << (isRightmost ? " R" : " L"));
+
+  iterator match = m_shouldUseHashIndex ? this->findIndexed(interest) :
+                                          this->findOrdered(interest);
+
+  if (match == m_table.end()) {
+    NFD_LOG_DEBUG("  no-match");
+    missCallback(interest);
+    return;
+  }
+  NFD_LOG_DEBUG("  matching " << match->getName());
+  m_policy->beforeUse(match);
+  shared_ptr<const Data> data = match->getData();
+  hitCallback(interest, *data);
+}
+
+iterator
+Cs::findOrdered(const Interest& interest) const
+{
   const Name& prefix = interest.getName();
   bool isRightmost = interest.getChildSelector() == 1;
-  NFD_LOG_DEBUG("find " << prefix << (isRightmost ? " R" : " L"));
 
   iterator first = m_table.lower_bound(prefix);
   iterator last = m_table.end();
@@ -142,14 +168,51 @@ Cs::find(const Interest& interest,
     match = this->findLeftmost(interest, first, last);
   }
 
-  if (match == last) {
-    NFD_LOG_DEBUG("  no-match");
-    missCallback(interest);
-    return;
+  return match == last ? m_table.end() : match;
+}
+
+iterator
+Cs::findIndexed(const Interest& interest) const
+{
+  const Name& prefix = interest.getName();
+
+  // a full Name query matches a stored Data Name without its last component
+  bool isFullName = !prefix.empty() && prefix[-1].isImplicitSha256Digest();
+  if (isFullName) {
+    return this->findOrdered(interest);
   }
-  NFD_LOG_DEBUG("  matching " << match->getName());
-  m_policy->beforeUse(match);
-  hitCallback(interest, match->getData());
+
+  size_t nameHash = name_tree::getHashSet(interest).back();
+  if (m_prefixCounts.find(nameHash) == m_prefixCounts.end()) {
+    NFD_LOG_TRACE("  no-stored-prefix");
+    return m_table.end();
+  }
+
+  // an exact Name match, if any, sorts before all other matches under the Interest Name
+  if (interest.getChildSelector() != 1) {
+    iterator match = this->findExact(interest, nameHash);
+    if (match != m_table.end()) {
+      NFD_LOG_TRACE("  exact-match");
+      return match;
+    }
+  }
+
+  return this->findOrdered(interest);
+}
+
+iterator
+Cs::findExact(const Interest& interest, size_t nameHash) const
+{
+  iterator match = m_table.end();
+  auto range = m_exactIndex.equal_range(nameHash);
+  for (auto i = range.first; i != range.second; ++i) {
+    iterator it = i->second;
+    if (it->getName() == interest.getName() && it->canSatisfy(interest) &&
+        (match == m_table.end() || *it < *match)) {
+      match = it;
+    }
+  }
+  return match;
 }
 
 iterator
@@ -201,6 +264,9 @@ Cs::setPolicyImpl(unique_ptr<Policy>& policy)
 {
   m_policy = std::move(policy);
   m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
+      if (m_shouldUseHashIndex) {
+        this->removeFromHashIndex(it);
+      }
       m_table.erase(it);
     });
 
@@ -208,6 +274,49 @@ Cs::setPolicyImpl(unique_ptr<Policy>& policy)
   BOOST_ASSERT(m_policy->getCs() == this);
 }
 
+void
+Cs::addToHashIndex(iterator it, const std::vector<size_t>& hashSet)
+{
+  m_exactIndex.insert(std::make_pair(hashSet.back(), it));
+  for (size_t prefixHash : hashSet) {
+    ++m_prefixCounts[prefixHash];
+  }
+}
+
+void
+Cs::removeFromHashIndex(iterator it)
+{
+  std::vector<size_t> hashSet = name_tree::computeHashSet(it->getName());
+
+  auto range = m_exactIndex.equal_range(hashSet.back());
+  for (auto i = range.first; i != range.second; ++i) {
+    if (i->second == it) {
+      m_exactIndex.erase(i);
+      break;
+    }
+  }
+
+  for (size_t prefixHash : hashSet) {
+    auto count = m_prefixCounts.find(prefixHash);
+    BOOST_ASSERT(count != m_prefixCounts.end());
+    if (--count->second == 0) {
+      m_prefixCounts.erase(count);
+    }
+  }
+}
+
+void
+Cs::setDefaultHashIndex(bool shouldUseHashIndex)
+{
+  s_shouldUseHashIndexDefault = shouldUseHashIndex;
+}
+
+bool
+Cs::getDefaultHashIndex()
+{
+  return s_shouldUseHashIndexDefault;
+}
+
 void
 Cs::dump()
 {
@@ -43,6 +43,12 @@
  *  Within each queue, the iterators are kept in first-in-first-out order.
  *  Eviction procedure exhausts the first queue before moving onto the next queue,
  *  in the order of unsolicited, stale, and fresh queue.
+ *
+ *  Optionally, the Table is supplemented by a hash index, which maps the hash of each
+ *  stored Data Name to its Table iterator, and counts the stored entries under every
+ *  prefix hash. It answers lookups for Interests without a ChildSelector whose Name equals a
+ *  stored Data Name, and lookups for Interests with no stored Data under their Name, without
+ *  searching the Table. All other lookups fall back to the Table.
  */
 
 #ifndef NFD_DAEMON_TABLE_CS_HPP
@@ -65,8 +71,13 @@ makeDefaultPolicy();
 class Cs : noncopyable
 {
 public:
+  /** \param nMaxPackets capacity (in number of packets)
+   *  \param policy cs replacement policy
+   *  \param shouldUseHashIndex whether lookups go through the hash index first
+   */
   explicit
-  Cs(size_t nMaxPackets = 10, unique_ptr<Policy> policy = makeDefaultPolicy());
+  Cs(size_t nMaxPackets = 10, unique_ptr<Policy> policy = makeDefaultPolicy(),
+     bool shouldUseHashIndex = Cs::getDefaultHashIndex());
 
   /** \brief inserts a Data packet
    *  \return true
@@ -127,6 +138,26 @@ public:
     return m_table.size();
   }
 
+  /** \return whether lookups go through the hash index first
+   */
+  bool
+  hasHashIndex() const
+  {
+    return m_shouldUseHashIndex;
+  }
+
+public: // hash index selection
+  /** \brief set whether ContentStores constructed without an explicit choice have a hash
+   *  index (false by default)
+   *  \details Intended for comparing both lookup paths in simulations, whose forwarders
+   *  construct their ContentStore internally (see tests/other/ndn-test.cpp).
+   */
+  static void
+  setDefaultHashIndex(bool shouldUseHashIndex);
+
+  static bool
+  getDefaultHashIndex();
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   dump();
@@ -160,6 +191,25 @@ public: // enumeration
   }
 
 private: // find
+  /** \brief find the match through the Table
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findOrdered(const Interest& interest) const;
+
+  /** \brief find the match through the hash index, falling back to findOrdered()
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findIndexed(const Interest& interest) const;
+
+  /** \brief find leftmost match among entries whose Name equals Interest Name
+   *  \param nameHash hash of Interest Name
+   *  \return the leftmost match, or m_table.end() if not found
+   */
+  iterator
+  findExact(const Interest& interest, size_t nameHash) const;
+
   /** \brief find leftmost match in [first,last)
    *  \return the leftmost match, or last if not found
    */
@@ -181,10 +231,27 @@ private: // find
   void
   setPolicyImpl(unique_ptr<Policy>& policy);
 
+private: // hash index
+  /** \param hashSet name_tree::computeHashSet of the stored Data Name
+   */
+  void
+  addToHashIndex(iterator it, const std::vector<size_t>& hashSet);
+
+  void
+  removeFromHashIndex(iterator it);
+
 private:
   Table m_table;
   unique_ptr<Policy> m_policy;
   ndn::util::signal::ScopedConnection m_beforeEvictConnection;
+
+  bool m_shouldUseHashIndex;
+  /// stored entries by hash of Data Name, see name_tree::computeHash
+  std::unordered_multimap<size_t, iterator> m_exactIndex;
+  /// number of stored entries under each prefix, by hash of the prefix
+  std::unordered_map<size_t, size_t> m_prefixCounts;
+
+  static bool s_shouldUseHashIndexDefault;
 };
 
 } // namespace cs
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dead-nonce-filter.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace nfd {
+
+const size_t DeadNonceFilter::BLOCK_BITS;
+const size_t DeadNonceFilter::MAX_N_HASHES;
+
+DeadNonceFilter::DeadNonceFilter(size_t nSlices, size_t nExpectedKeysPerSlice,
+                                 double falsePositiveRate)
+  : m_nKeys(std::max<size_t>(nSlices, 2), 0)
+  , m_currentSlice(0)
+{
+  BOOST_ASSERT(falsePositiveRate > 0 && falsePositiveRate < 1);
+
+  // A key tests all slices, so each slice gets an equal share of the false positive budget.
+  // The size of a standard Bloom filter is increased by a quarter to make up for keys
+  // crowding in some blocks.
+  double sliceRate = falsePositiveRate / m_nKeys.size();
+  double nBitsPerKey = -std::log(sliceRate) / (std::log(2.0) * std::log(2.0)) * 1.25;
+  double nBits = std::max<double>(nExpectedKeysPerSlice, 1) * nBitsPerKey;
+
+  m_nBlocksPerSlice = std::max<size_t>(static_cast<size_t>(std::ceil(nBits / BLOCK_BITS)), 1);
+  m_nHashes = std::min<size_t>(std::max<long>(std::lround(nBitsPerKey / 1.25 * std::log(2.0)), 1),
+                               MAX_N_HASHES);
+
+  static_assert(sizeof(Block) == BLOCK_BITS / 8, "Block must be one cache line");
+
+  // operator new does not guarantee cache line alignment
+  size_t nBytes = this->getNReservedBytes();
+  m_memory = ::operator new(nBytes + alignof(Block) - 1);
+  uintptr_t aligned = (reinterpret_cast<uintptr_t>(m_memory) + alignof(Block) - 1) &
+                      ~static_cast<uintptr_t>(alignof(Block) - 1);
+  m_blocks = reinterpret_cast<Block*>(aligned);
+  std::memset(m_blocks, 0, nBytes);
+}
+
+DeadNonceFilter::~DeadNonceFilter()
+{
+  ::operator delete(m_memory);
+}
+
+bool
+DeadNonceFilter::contains(uint64_t key) const
+{
+  size_t blockIndex = this->getBlockIndex(key);
+  uint64_t bitPositions = getBitPositions(key);
+
+  for (size_t slice = 0; slice < m_nKeys.size(); ++slice) {
+    const Block& block = m_blocks[slice * m_nBlocksPerSlice + blockIndex];
+    bool isFound = true;
+    uint64_t positions = bitPositions;
+    for (size_t i = 0; i < m_nHashes && isFound; ++i, positions >>= 9) {
+      size_t bit = positions & (BLOCK_BITS - 1);
+      isFound = (block.words[bit / 64] >> (bit % 64)) & 1;
+    }
+    if (isFound) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadNonceFilter::add(uint64_t key)
+{
+  Block& block = m_blocks[m_currentSlice * m_nBlocksPerSlice + this->getBlockIndex(key)];
+  uint64_t positions = getBitPositions(key);
+  for (size_t i = 0; i < m_nHashes; ++i, positions >>= 9) {
+    size_t bit = positions & (BLOCK_BITS - 1);
+    block.words[bit / 64] |= uint64_t(1) << (bit % 64);
+  }
+  ++m_nKeys[m_currentSlice];
+}
+
+void
+DeadNonceFilter::rotate()
+{
+  m_currentSlice = (m_currentSlice + 1) % m_nKeys.size();
+
+  std::memset(m_blocks + m_currentSlice * m_nBlocksPerSlice, 0,
+              m_nBlocksPerSlice * sizeof(Block));
+  m_nKeys[m_currentSlice] = 0;
+}
+
+size_t
+DeadNonceFilter::size() const
+{
+  return std::accumulate(m_nKeys.begin(), m_nKeys.end(), size_t(0));
+}
+
+} // namespace nfd
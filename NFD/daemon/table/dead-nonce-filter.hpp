@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+#define NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief ring of time slices, each a blocked Bloom filter of 64-bit keys
+ *
+ *  A blocked Bloom filter sets and tests all bits of a key in one 512-bit block, which is one
+ *  cache line. Keys are added to the current slice. rotate() clears the oldest slice and makes
+ *  it the current one, so a key is remembered for between nSlices - 1 and nSlices rotation
+ *  intervals. contains() tests every slice.
+ *
+ *  Memory is allocated once, and lookups probe exactly one block per slice. If more keys than
+ *  expected are added to a slice, its false positive rate grows instead of its memory.
+ */
+class DeadNonceFilter : noncopyable
+{
+public:
+  /** \param nSlices number of slices, at least 2
+   *  \param nExpectedKeysPerSlice number of keys a slice is sized for
+   *  \param falsePositiveRate probability that contains() is true for a key not in any slice,
+   *         when every slice holds nExpectedKeysPerSlice keys
+   */
+  DeadNonceFilter(size_t nSlices, size_t nExpectedKeysPerSlice, double falsePositiveRate);
+
+  ~DeadNonceFilter();
+
+  bool
+  contains(uint64_t key) const;
+
+  void
+  add(uint64_t key);
+
+  /** \brief clear the oldest slice and make it the current one
+   */
+  void
+  rotate();
+
+  /** \return number of keys added to all slices since they were cleared
+   */
+  size_t
+  size() const;
+
+  size_t
+  getNSlices() const
+  {
+    return m_nKeys.size();
+  }
+
+  /** \return number of bits set and tested per key
+   */
+  size_t
+  getNHashes() const
+  {
+    return m_nHashes;
+  }
+
+  /** \return bytes allocated for the blocks of all slices
+   */
+  size_t
+  getNReservedBytes() const
+  {
+    return m_nBlocksPerSlice * m_nKeys.size() * sizeof(Block);
+  }
+
+public:
+  static const size_t BLOCK_BITS = 512;
+  /// upper bound of getNHashes(), bit positions are taken 9 bits at a time from one hash
+  static const size_t MAX_N_HASHES = 7;
+
+private:
+  struct alignas(BLOCK_BITS / 8) Block
+  {
+    uint64_t words[BLOCK_BITS / 64];
+  };
+
+  /** \return index of the block of \p key within a slice
+   */
+  size_t
+  getBlockIndex(uint64_t key) const
+  {
+    // multiply-shift maps the high half of the key onto [0, m_nBlocksPerSlice)
+    return static_cast<size_t>(((key >> 32) * m_nBlocksPerSlice) >> 32);
+  }
+
+  /** \return bit positions of \p key within its block, 9 bits each
+   */
+  static uint64_t
+  getBitPositions(uint64_t key)
+  {
+    return key * 0x9e3779b97f4a7c15ULL;
+  }
+
+private:
+  size_t m_nBlocksPerSlice;
+  size_t m_nHashes;
+  Block* m_blocks; ///< blocks of slice i are [i*m_nBlocksPerSlice, (i+1)*...)
+  void* m_memory; ///< allocation holding m_blocks, which starts at the next cache line
+  std::vector<size_t> m_nKeys; ///< number of keys added to each slice
+  size_t m_currentSlice;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
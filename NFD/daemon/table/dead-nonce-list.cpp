@@ -24,6 +24,7 @@
  */
 
 #include "dead-nonce-list.hpp"
+#include "name-tree.hpp"
 #include "core/city-hash.hpp"
 #include "core/logger.hpp"
 
@@ -41,11 +42,38 @@ const size_t DeadNonceList::EXPECTED_MARK_COUNT = 5;
 const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = (1 << 6);
+const size_t DeadNonceList::N_FILTER_SLICES = 4;
 
-DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
+DeadNonceList::BloomFilterOptions DeadNonceList::s_defaultBloomFilterOptions;
+
+DeadNonceList::BloomFilterOptions::BloomFilterOptions()
+  : isEnabled(false)
+  , nExpectedEntries(1 << 16)
+  , falsePositiveRate(0.001)
+  , shouldCountFalsePositives(false)
+{
+}
+
+void
+DeadNonceList::setDefaultBloomFilterOptions(const BloomFilterOptions& options)
+{
+  s_defaultBloomFilterOptions = options;
+}
+
+const DeadNonceList::BloomFilterOptions&
+DeadNonceList::getDefaultBloomFilterOptions()
+{
+  return s_defaultBloomFilterOptions;
+}
+
+DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime,
+                             const BloomFilterOptions& bloomFilterOptions)
   : m_lifetime(lifetime)
   , m_queue(m_index.get<0>())
   , m_ht(m_index.get<1>())
+  , m_shouldCountFalsePositives(false)
+  , m_nFalsePositives(0)
+  , m_rotateInterval(m_lifetime / (N_FILTER_SLICES - 1))
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
   , m_adjustCapacityInterval(m_lifetime)
@@ -54,6 +82,21 @@ DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
     BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
+  if (bloomFilterOptions.isEnabled) {
+    // each slice is current for one rotation interval
+    size_t nExpectedEntriesPerSlice = bloomFilterOptions.nExpectedEntries / (N_FILTER_SLICES - 1);
+    m_filter.reset(new DeadNonceFilter(N_FILTER_SLICES, nExpectedEntriesPerSlice,
+                                       bloomFilterOptions.falsePositiveRate));
+    m_shouldCountFalsePositives = bloomFilterOptions.shouldCountFalsePositives;
+    m_rotateEvent = scheduler::schedule(m_rotateInterval,
+                                        bind(&DeadNonceList::rotateFilter, this));
+    NFD_LOG_DEBUG("Bloom filter nHashes=" << m_filter->getNHashes() <<
+                  " nReservedBytes=" << m_filter->getNReservedBytes());
+
+    // the index, if kept, is trimmed along with the filter slices instead of by capacity
+    return;
+  }
+
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
     m_queue.push_back(MARK);
   }
@@ -67,6 +110,7 @@ DeadNonceList::~DeadNonceList()
 {
   scheduler::cancel(m_markEvent);
   scheduler::cancel(m_adjustCapacityEvent);
+  scheduler::cancel(m_rotateEvent);
 
   BOOST_ASSERT_MSG(DEFAULT_LIFETIME >= MIN_LIFETIME, "DEFAULT_LIFETIME is too small");
   static_assert(INITIAL_CAPACITY >= MIN_CAPACITY, "INITIAL_CAPACITY is too small");
@@ -78,36 +122,82 @@ DeadNonceList::~DeadNonceList()
   BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must adjust up");
   BOOST_ASSERT_MSG(CAPACITY_DOWN < 1.0, "CAPACITY_DOWN must adjust down");
   static_assert(EVICT_LIMIT >= 1, "EVICT_LIMIT must be at least 1");
+  BOOST_ASSERT_MSG(N_FILTER_SLICES >= 2, "N_FILTER_SLICES must be at least 2");
 }
 
 size_t
 DeadNonceList::size() const
 {
+  if (m_filter != nullptr) {
+    return m_filter->size();
+  }
   return m_queue.size() - this->countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
-  return m_ht.find(entry) != m_ht.end();
+  return this->hasEntry(DeadNonceList::makeEntry(name_tree::computeHash(name), nonce));
+}
+
+bool
+DeadNonceList::has(const Interest& interest) const
+{
+  return this->hasEntry(DeadNonceList::makeEntry(name_tree::getHashSet(interest).back(),
+                                                 interest.getNonce()));
+}
+
+bool
+DeadNonceList::hasEntry(Entry entry) const
+{
+  if (m_filter == nullptr) {
+    return m_ht.find(entry) != m_ht.end();
+  }
+
+  if (!m_filter->contains(entry)) {
+    return false;
+  }
+  if (m_shouldCountFalsePositives && m_ht.find(entry) == m_ht.end()) {
+    ++m_nFalsePositives;
+    NFD_LOG_TRACE("false positive nFalsePositives=" << m_nFalsePositives);
+  }
+  return true;
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  this->addEntry(DeadNonceList::makeEntry(name_tree::computeHash(name), nonce));
+}
+
+void
+DeadNonceList::add(const Interest& interest, uint32_t nonce)
+{
+  this->addEntry(DeadNonceList::makeEntry(name_tree::getHashSet(interest).back(), nonce));
+}
+
+void
+DeadNonceList::addEntry(Entry entry)
+{
+  if (m_filter != nullptr) {
+    m_filter->add(entry);
+    if (m_shouldCountFalsePositives) {
+      m_queue.push_back(entry);
+    }
+    return;
+  }
+
   m_queue.push_back(entry);
 
   this->evictEntries();
 }
 
 DeadNonceList::Entry
-DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
+DeadNonceList::makeEntry(size_t nameHash, uint32_t nonce)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                            static_cast<uint64_t>(nonce));
+  // the name was hashed already, so only the Nonce is hashed here, seeded with the name hash
+  return CityHash64WithSeed(reinterpret_cast<const char*>(&nonce), sizeof(nonce),
+                            static_cast<uint64_t>(nameHash));
 }
 
 size_t
@@ -168,4 +258,25 @@ DeadNonceList::evictEntries()
   BOOST_ASSERT(m_queue.size() >= m_capacity);
 }
 
+void
+DeadNonceList::rotateFilter()
+{
+  m_filter->rotate();
+  NFD_LOG_TRACE("rotateFilter size=" << m_filter->size());
+
+  if (m_shouldCountFalsePositives) {
+    // MARKs separate the entries of each slice; drop the entries of the cleared slice
+    m_queue.push_back(MARK);
+    if (this->countMarks() >= N_FILTER_SLICES) {
+      while (m_queue.front() != MARK) {
+        m_queue.pop_front();
+      }
+      m_queue.pop_front();
+    }
+  }
+
+  m_rotateEvent = scheduler::schedule(m_rotateInterval,
+                                      bind(&DeadNonceList::rotateFilter, this));
+}
+
 } // namespace nfd
@@ -31,6 +31,7 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include "core/scheduler.hpp"
+#include "dead-nonce-filter.hpp"
 
 namespace nfd {
 
@@ -50,19 +51,43 @@ namespace nfd {
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Optionally, entries are kept in a DeadNonceFilter instead, which has a fixed memory size and
+ *  lookup cost, and bounds the lifetime of entries by rotating its slices at fixed intervals.
+ *  The filter adds false positives at a configured rate. To count them, the index is kept
+ *  next to the filter, holding the same entries, and consulted after every positive answer of
+ *  the filter.
  */
 class DeadNonceList : noncopyable
 {
 public:
+  /** \brief options of the Bloom filter backend
+   */
+  struct BloomFilterOptions
+  {
+    BloomFilterOptions();
+
+    /// whether the filter replaces the index
+    bool isEnabled;
+    /// number of Nonces expected to be added during one lifetime
+    size_t nExpectedEntries;
+    /// false positive rate of the filter when it holds nExpectedEntries per lifetime
+    double falsePositiveRate;
+    /// whether the index is kept to count false positives of the filter
+    bool shouldCountFalsePositives;
+  };
+
   /** \brief constructs the Dead Nonce List
    *  \param lifetime duration of the expected lifetime of each nonce,
    *         must be no less than MIN_LIFETIME.
    *         This should be set to the duration in which most loops would have occured.
    *         A loop cannot be detected if delay of the cycle is greater than lifetime.
+   *  \param bloomFilterOptions whether and how to use a DeadNonceFilter
    *  \throw std::invalid_argument if lifetime is less than MIN_LIFETIME
    */
   explicit
-  DeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME);
+  DeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME,
+                const BloomFilterOptions& bloomFilterOptions = getDefaultBloomFilterOptions());
 
   ~DeadNonceList();
 
@@ -72,13 +97,29 @@ public:
   bool
   has(const Name& name, uint32_t nonce) const;
 
+  /** \brief determines if the Name and Nonce of \p interest exist
+   *  \details Same as has(interest.getName(), interest.getNonce()), but reuses the name hash
+   *           cached on the Interest by name_tree::getHashSet.
+   */
+  bool
+  has(const Interest& interest) const;
+
   /** \brief records name+nonce
    */
   void
   add(const Name& name, uint32_t nonce);
 
+  /** \brief records the Name of \p interest with \p nonce
+   *  \details Same as add(interest.getName(), nonce), but reuses the name hash cached on the
+   *           Interest by name_tree::getHashSet.
+   */
+  void
+  add(const Interest& interest, uint32_t nonce);
+
   /** \return number of stored Nonces
    *  \note The return value does not contain non-Nonce entries in the index, if any.
+   *        With the Bloom filter, it is the number of Nonces added to the filter slices that
+   *        have not been cleared.
    */
   size_t
   size() const;
@@ -88,11 +129,44 @@ public:
   const time::nanoseconds&
   getLifetime() const;
 
+  /** \return whether a DeadNonceFilter is used
+   */
+  bool
+  hasBloomFilter() const
+  {
+    return m_filter != nullptr;
+  }
+
+  /** \return number of lookups that the filter answered positively but the index did not
+   *  \note Always zero unless BloomFilterOptions::shouldCountFalsePositives is set.
+   */
+  uint64_t
+  getNFalsePositives() const
+  {
+    return m_nFalsePositives;
+  }
+
+  /** \brief set the Bloom filter options of Dead Nonce Lists constructed afterwards
+   */
+  static void
+  setDefaultBloomFilterOptions(const BloomFilterOptions& options);
+
+  static const BloomFilterOptions&
+  getDefaultBloomFilterOptions();
+
 private: // Entry and Index
   typedef uint64_t Entry;
 
+  /** \param nameHash name_tree::computeHash of the Interest Name
+   */
   static Entry
-  makeEntry(const Name& name, uint32_t nonce);
+  makeEntry(size_t nameHash, uint32_t nonce);
+
+  bool
+  hasEntry(Entry entry) const;
+
+  void
+  addEntry(Entry entry);
 
   typedef boost::multi_index_container<
     Entry,
@@ -131,6 +205,11 @@ private: // actual lifetime estimation and capacity control
   void
   evictEntries();
 
+  /** \brief clear the oldest slice of the filter
+   */
+  void
+  rotateFilter();
+
 public:
   /// default entry lifetime
   static const time::nanoseconds DEFAULT_LIFETIME;
@@ -144,6 +223,14 @@ private:
   Queue& m_queue;
   Hashtable& m_ht;
 
+  unique_ptr<DeadNonceFilter> m_filter;
+  bool m_shouldCountFalsePositives;
+  mutable uint64_t m_nFalsePositives;
+  time::nanoseconds m_rotateInterval;
+  scheduler::EventId m_rotateEvent;
+
+  static BloomFilterOptions s_defaultBloomFilterOptions;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity control
 
   // ---- current capacity and hard limits
@@ -209,6 +296,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity contr
   /** \brief maximum number of entries to evict at each operation if index is over capacity
    */
   static const size_t EVICT_LIMIT;
+
+  /** \brief number of filter slices
+   *
+   *  Entries are kept for at least (N_FILTER_SLICES - 1) rotation intervals, which add up to
+   *  the lifetime.
+   */
+  static const size_t N_FILTER_SLICES;
 };
 
 inline const time::nanoseconds&
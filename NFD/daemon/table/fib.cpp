@@ -49,6 +49,7 @@ BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Fib::const_iterator>));
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
 }
 
@@ -79,10 +80,15 @@ Fib::findLongestPrefixMatch(shared_ptr<name_tree::Entry> nameTreeEntry) const
   shared_ptr<fib::Entry> entry = nameTreeEntry->getFibEntry();
   if (static_cast<bool>(entry))
     return entry;
-  nameTreeEntry = m_nameTree.findLongestPrefixMatch(nameTreeEntry,
-                                                    &predicate_NameTreeEntry_hasFibEntry);
-  if (static_cast<bool>(nameTreeEntry)) {
-    return nameTreeEntry->getFibEntry();
+
+  name_tree::LpmCache& cache = nameTreeEntry->getLpmCache(name_tree::LPM_FIB);
+  if (cache.generation != m_generation) {
+    cache.match = m_nameTree.findLongestPrefixMatch(nameTreeEntry,
+                                                    &predicate_NameTreeEntry_hasFibEntry).get();
+    cache.generation = m_generation;
+  }
+  if (cache.match != 0) {
+    return cache.match->getFibEntry();
   }
   return s_emptyEntry;
 }
@@ -126,6 +132,7 @@ Fib::insert(const Name& prefix)
   entry = make_shared<fib::Entry>(prefix);
   nameTreeEntry->setFibEntry(entry);
   ++m_nItems;
+  ++m_generation;
   return std::make_pair(entry, true);
 }
 
@@ -135,6 +142,7 @@ Fib::erase(shared_ptr<name_tree::Entry> nameTreeEntry)
   nameTreeEntry->setFibEntry(shared_ptr<fib::Entry>());
   m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
   --m_nItems;
+  ++m_generation;
 }
 
 void
@@ -73,12 +73,16 @@ public:
                          const measurements::EntryPredicate& pred =
                              measurements::AnyEntry()) const;
 
+  /** \brief perform a longest prefix match for \p pitEntry.getName()
+   */
+  shared_ptr<measurements::Entry>
+  findLongestPrefixMatch(const pit::Entry& pitEntry) const;
+
   /** \brief perform a longest prefix match for \p pitEntry.getName()
    */
   shared_ptr<measurements::Entry>
   findLongestPrefixMatch(const pit::Entry& pitEntry,
-                         const measurements::EntryPredicate& pred =
-                             measurements::AnyEntry()) const;
+                         const measurements::EntryPredicate& pred) const;
 
   /** \brief perform an exact match
    */
@@ -136,6 +140,12 @@ MeasurementsAccessor::findLongestPrefixMatch(const Name& name,
   return this->filter(m_measurements.findLongestPrefixMatch(name, pred));
 }
 
+inline shared_ptr<measurements::Entry>
+MeasurementsAccessor::findLongestPrefixMatch(const pit::Entry& pitEntry) const
+{
+  return this->filter(m_measurements.findLongestPrefixMatch(pitEntry));
+}
+
 inline shared_ptr<measurements::Entry>
 MeasurementsAccessor::findLongestPrefixMatch(const pit::Entry& pitEntry,
                                              const measurements::EntryPredicate& pred) const
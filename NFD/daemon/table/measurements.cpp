@@ -35,6 +35,7 @@ using measurements::Entry;
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
 }
 
@@ -48,10 +49,10 @@ Measurements::get(name_tree::Entry& nte)
   entry = make_shared<Entry>(nte.getPrefix());
   nte.setMeasurementsEntry(entry);
   ++m_nItems;
+  ++m_generation;
 
   entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(),
-                                         bind(&Measurements::cleanup, this, ref(*entry)));
+  entry->m_cleanup.schedule(getInitialLifetime(), &Measurements::cleanup, this, ref(*entry));
 
   return entry;
 }
@@ -113,6 +114,27 @@ Measurements::findLongestPrefixMatch(const Name& name,
   return this->findLongestPrefixMatchImpl(name, pred);
 }
 
+shared_ptr<Entry>
+Measurements::findLongestPrefixMatch(const pit::Entry& pitEntry) const
+{
+  shared_ptr<name_tree::Entry> nte = m_nameTree.get(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+
+  name_tree::LpmCache& cache = nte->getLpmCache(name_tree::LPM_MEASUREMENTS);
+  if (cache.generation != m_generation) {
+    cache.match = m_nameTree.findLongestPrefixMatch(nte,
+      [] (const name_tree::Entry& entry) {
+        return entry.getMeasurementsEntry() != nullptr;
+      }).get();
+    cache.generation = m_generation;
+  }
+
+  if (cache.match != nullptr) {
+    return cache.match->getMeasurementsEntry();
+  }
+  return nullptr;
+}
+
 shared_ptr<Entry>
 Measurements::findLongestPrefixMatch(const pit::Entry& pitEntry,
                                      const measurements::EntryPredicate& pred) const
@@ -147,9 +169,8 @@ Measurements::extendLifetime(Entry& entry,
     return;
   }
 
-  scheduler::cancel(entry.m_cleanup);
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, bind(&Measurements::cleanup, this, ref(entry)));
+  entry.m_cleanup.schedule(lifetime, &Measurements::cleanup, this, ref(entry));
 }
 
 void
@@ -160,6 +181,7 @@ Measurements::cleanup(Entry& entry)
     nte->setMeasurementsEntry(nullptr);
     m_nameTree.eraseEntryIfEmpty(nte);
     m_nItems--;
+    ++m_generation;
   }
 }
 
@@ -108,10 +108,16 @@ public:
       measurements::AnyEntry()) const;
 
   /** \brief perform a longest prefix match for \p pitEntry.getName()
+   *  \details The result is cached on the NameTree entry of \p pitEntry.
    */
   shared_ptr<measurements::Entry>
-  findLongestPrefixMatch(const pit::Entry& pitEntry, const measurements::EntryPredicate& pred =
-      measurements::AnyEntry()) const;
+  findLongestPrefixMatch(const pit::Entry& pitEntry) const;
+
+  /** \brief perform a longest prefix match for \p pitEntry.getName()
+   */
+  shared_ptr<measurements::Entry>
+  findLongestPrefixMatch(const pit::Entry& pitEntry,
+                         const measurements::EntryPredicate& pred) const;
 
   /** \brief perform an exact match
    */
@@ -147,6 +153,9 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  /// changes whenever an entry is attached to or detached from the NameTree,
+  /// see name_tree::LpmCache
+  uint64_t m_generation;
 };
 
 inline time::nanoseconds
@@ -59,6 +59,36 @@ public:
   Node* m_next; // Next Name Tree Node (to resolve hash collision)
 };
 
+/**
+ * \brief tables whose longest prefix match is cached on a Name Tree Entry
+ */
+enum LpmTable {
+  LPM_FIB,
+  LPM_STRATEGY_CHOICE,
+  LPM_MEASUREMENTS,
+  LPM_MAX
+};
+
+/**
+ * \brief longest prefix match result cached on a Name Tree Entry
+ * \details match is the entry itself or one of its ancestors, which are kept alive through
+ * the parent pointers, or null if nothing matched. The result is valid as long as
+ * generation equals the current generation of the table it was computed for; tables
+ * change their generation whenever they attach entries to or detach entries from the Name
+ * Tree. Generation 0 is never used by a table.
+ */
+struct LpmCache
+{
+  LpmCache()
+    : match(0)
+    , generation(0)
+  {
+  }
+
+  Entry* match;
+  uint64_t generation;
+};
+
 /**
  * \brief Name Tree Entry Class
  */
@@ -125,6 +155,10 @@ public: // attached table entries
   shared_ptr<strategy_choice::Entry>
   getStrategyChoiceEntry() const;
 
+public: // cached longest prefix matches
+  LpmCache&
+  getLpmCache(LpmTable table);
+
 private:
   // Benefits of storing m_hash
   // 1. m_hash is compared before m_prefix is compared
@@ -137,10 +171,15 @@ private:
   std::vector<shared_ptr<pit::Entry> > m_pitEntries;
   shared_ptr<measurements::Entry> m_measurementsEntry;
   shared_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
+  LpmCache m_lpmCaches[LPM_MAX];
 
   // get the Name Tree Node that is associated with this Name Tree Entry
   Node* m_node;
 
+  // keeps this entry alive while it is stored in a name_tree::Hashtable, which holds
+  // plain pointers (the counterpart of Node::m_entry)
+  shared_ptr<Entry> m_hashtableRef;
+
   // Make private members accessible by Name Tree
   friend class nfd::NameTree;
 };
@@ -217,6 +256,13 @@ Entry::getStrategyChoiceEntry() const
   return m_strategyChoiceEntry;
 }
 
+inline LpmCache&
+Entry::getLpmCache(LpmTable table)
+{
+  BOOST_ASSERT(table < LPM_MAX);
+  return m_lpmCaches[table];
+}
+
 } // namespace name_tree
 } // namespace nfd
 
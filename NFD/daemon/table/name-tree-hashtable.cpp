@@ -0,0 +1,268 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "name-tree-hashtable.hpp"
+#include "name-tree-entry.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace nfd {
+namespace name_tree {
+
+const size_t Hashtable::BUCKET_SIZE;
+const size_t Hashtable::N_SLOTS_PER_BUCKET;
+const double Hashtable::MAX_LOAD_FACTOR = 0.75;
+const double Hashtable::MIN_LOAD_FACTOR = 0.1;
+const size_t Hashtable::N_MIGRATED_BUCKETS_PER_STEP;
+
+Hashtable::BucketArray::BucketArray()
+  : buckets(nullptr)
+  , mask(0)
+  , nBuckets(0)
+  , memory(nullptr)
+{
+}
+
+void
+Hashtable::BucketArray::allocate(size_t nBuckets)
+{
+  BOOST_ASSERT(buckets == nullptr);
+  BOOST_ASSERT((nBuckets & (nBuckets - 1)) == 0);
+
+  // operator new does not guarantee cache line alignment
+  memory = ::operator new(nBuckets * sizeof(Bucket) + BUCKET_SIZE - 1);
+  uintptr_t aligned = (reinterpret_cast<uintptr_t>(memory) + BUCKET_SIZE - 1) &
+                      ~static_cast<uintptr_t>(BUCKET_SIZE - 1);
+  buckets = reinterpret_cast<Bucket*>(aligned);
+  std::memset(buckets, 0, nBuckets * sizeof(Bucket));
+
+  this->mask = nBuckets - 1;
+  this->nBuckets = nBuckets;
+}
+
+void
+Hashtable::BucketArray::release()
+{
+  ::operator delete(memory);
+  buckets = nullptr;
+  mask = 0;
+  nBuckets = 0;
+  memory = nullptr;
+}
+
+Hashtable::Hashtable(size_t nSlots)
+  : m_nMigratedBuckets(0)
+  , m_nItems(0)
+{
+  static_assert(sizeof(Bucket) <= BUCKET_SIZE, "Bucket must fit into one cache line");
+
+  size_t nBuckets = 1;
+  while (nBuckets * N_SLOTS_PER_BUCKET < nSlots) {
+    nBuckets <<= 1;
+  }
+  m_minNBuckets = nBuckets;
+  m_buckets.allocate(nBuckets);
+}
+
+Hashtable::~Hashtable()
+{
+  m_buckets.release();
+  if (isResizing()) {
+    m_oldBuckets.release();
+  }
+}
+
+void
+Hashtable::place(BucketArray& array, Entry& entry)
+{
+  size_t hash = entry.getHash();
+  for (size_t i = hash & array.mask;; i = (i + 1) & array.mask) {
+    Bucket& bucket = array.buckets[i];
+    for (size_t slot = 0; slot < N_SLOTS_PER_BUCKET; ++slot) {
+      if (bucket.fingerprints[slot] == 0) {
+        bucket.fingerprints[slot] = getFingerprint(hash);
+        bucket.entries[slot] = &entry;
+        return;
+      }
+    }
+    BOOST_ASSERT(bucket.nOverflows < std::numeric_limits<uint16_t>::max());
+    ++bucket.nOverflows;
+  }
+}
+
+bool
+Hashtable::locate(const BucketArray& array, const Entry& entry, size_t& bucket, size_t& slot)
+{
+  size_t hash = entry.getHash();
+  for (size_t i = hash & array.mask, nProbes = 0; nProbes < array.nBuckets;
+       i = (i + 1) & array.mask, ++nProbes) {
+    const Bucket& b = array.buckets[i];
+    for (size_t s = 0; s < N_SLOTS_PER_BUCKET; ++s) {
+      if (b.entries[s] == &entry) {
+        bucket = i;
+        slot = s;
+        return true;
+      }
+    }
+    if (b.nOverflows == 0) {
+      break;
+    }
+  }
+  return false;
+}
+
+void
+Hashtable::remove(BucketArray& array, const Entry& entry, size_t bucket, size_t slot)
+{
+  for (size_t i = entry.getHash() & array.mask; i != bucket; i = (i + 1) & array.mask) {
+    BOOST_ASSERT(array.buckets[i].nOverflows > 0);
+    --array.buckets[i].nOverflows;
+  }
+  array.buckets[bucket].fingerprints[slot] = 0;
+  array.buckets[bucket].entries[slot] = nullptr;
+}
+
+void
+Hashtable::insert(Entry& entry)
+{
+  if (m_nItems + 1 > MAX_LOAD_FACTOR * getNSlots()) {
+    startResize(m_buckets.nBuckets * 2);
+  }
+  else if (isResizing()) {
+    migrate(N_MIGRATED_BUCKETS_PER_STEP);
+  }
+
+  place(m_buckets, entry);
+  ++m_nItems;
+}
+
+void
+Hashtable::erase(const Entry& entry)
+{
+  size_t bucket = 0;
+  size_t slot = 0;
+  if (locate(m_buckets, entry, bucket, slot)) {
+    remove(m_buckets, entry, bucket, slot);
+  }
+  else if (isResizing() && locate(m_oldBuckets, entry, bucket, slot)) {
+    remove(m_oldBuckets, entry, bucket, slot);
+  }
+  else {
+    BOOST_ASSERT_MSG(false, "entry is not stored");
+    return;
+  }
+  --m_nItems;
+
+  if (isResizing()) {
+    migrate(N_MIGRATED_BUCKETS_PER_STEP);
+  }
+  else if (m_buckets.nBuckets > m_minNBuckets && m_nItems < MIN_LOAD_FACTOR * getNSlots()) {
+    startResize(m_buckets.nBuckets / 2);
+  }
+}
+
+Entry*
+Hashtable::getFirst() const
+{
+  return scanFrom(&m_buckets, 0, 0);
+}
+
+Entry*
+Hashtable::getNext(const Entry& entry) const
+{
+  size_t bucket = 0;
+  size_t slot = 0;
+  if (locate(m_buckets, entry, bucket, slot)) {
+    return scanFrom(&m_buckets, bucket, slot + 1);
+  }
+  if (isResizing() && locate(m_oldBuckets, entry, bucket, slot)) {
+    return scanFrom(&m_oldBuckets, bucket, slot + 1);
+  }
+  return nullptr;
+}
+
+Entry*
+Hashtable::scanFrom(const BucketArray* array, size_t bucket, size_t slot) const
+{
+  // the current array is enumerated before the one being moved into it
+  while (array != nullptr) {
+    for (; bucket < array->nBuckets; ++bucket, slot = 0) {
+      const Bucket& b = array->buckets[bucket];
+      for (; slot < N_SLOTS_PER_BUCKET; ++slot) {
+        if (b.fingerprints[slot] != 0) {
+          return b.entries[slot];
+        }
+      }
+    }
+
+    array = (array == &m_buckets && isResizing()) ? &m_oldBuckets : nullptr;
+    bucket = 0;
+    slot = 0;
+  }
+  return nullptr;
+}
+
+void
+Hashtable::startResize(size_t nBuckets)
+{
+  if (isResizing()) {
+    // the previous resize has not finished yet
+    migrate(m_oldBuckets.nBuckets);
+  }
+
+  m_oldBuckets = m_buckets;
+  m_buckets = BucketArray();
+  m_buckets.allocate(nBuckets);
+  m_nMigratedBuckets = 0;
+
+  migrate(N_MIGRATED_BUCKETS_PER_STEP);
+}
+
+void
+Hashtable::migrate(size_t nBuckets)
+{
+  size_t end = std::min(m_nMigratedBuckets + nBuckets, m_oldBuckets.nBuckets);
+  for (; m_nMigratedBuckets < end; ++m_nMigratedBuckets) {
+    // overflow counts of old buckets are left as they are: they only need to be large
+    // enough for the entries that are still to be moved
+    Bucket& bucket = m_oldBuckets.buckets[m_nMigratedBuckets];
+    for (size_t slot = 0; slot < N_SLOTS_PER_BUCKET; ++slot) {
+      if (bucket.fingerprints[slot] != 0) {
+        place(m_buckets, *bucket.entries[slot]);
+        bucket.fingerprints[slot] = 0;
+        bucket.entries[slot] = nullptr;
+      }
+    }
+  }
+
+  if (m_nMigratedBuckets == m_oldBuckets.nBuckets) {
+    m_oldBuckets.release();
+    m_nMigratedBuckets = 0;
+  }
+}
+
+} // namespace name_tree
+} // namespace nfd
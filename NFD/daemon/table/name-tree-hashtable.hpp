@@ -0,0 +1,241 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_NAME_TREE_HASHTABLE_HPP
+#define NFD_DAEMON_TABLE_NAME_TREE_HASHTABLE_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace name_tree {
+
+class Entry;
+
+/** \brief open addressing hash table of Name Tree Entries
+ *
+ *  Slots are grouped into buckets of one cache line. A bucket stores a 16-bit fingerprint of
+ *  the hash of each of its entries next to the entry pointers, so a probe reads one line and
+ *  touches an entry only when its fingerprint matches. An entry is placed in the first bucket
+ *  with a free slot, starting at the bucket selected by its hash (linear probing). Every
+ *  bucket counts the entries that were placed past it, so a probe can stop at the first
+ *  bucket with a zero count.
+ *
+ *  The table grows and shrinks incrementally: resizing allocates the new bucket array and each
+ *  following insert() or erase() moves a few buckets of the old array into it. Until all are
+ *  moved, lookups search both arrays.
+ *
+ *  The table does not own the entries. The hash of an entry must not change while it is
+ *  stored.
+ */
+class Hashtable : noncopyable
+{
+public:
+  /** \param nSlots number of slots to start with, also the minimum the table shrinks to
+   */
+  explicit
+  Hashtable(size_t nSlots);
+
+  ~Hashtable();
+
+  /** \return the first entry with hash \p hash that satisfies \p pred, or nullptr
+   *  \tparam Predicate bool(const Entry&); called only on entries whose fingerprint matches,
+   *          it still needs to compare the full hash
+   */
+  template<typename Predicate>
+  Entry*
+  find(size_t hash, const Predicate& pred) const;
+
+  /** \brief store \p entry, which must not be stored yet
+   */
+  void
+  insert(Entry& entry);
+
+  /** \brief remove \p entry, which must be stored
+   */
+  void
+  erase(const Entry& entry);
+
+  /** \return the first entry in enumeration order, or nullptr if the table is empty
+   */
+  Entry*
+  getFirst() const;
+
+  /** \return the entry following \p entry in enumeration order, or nullptr
+   *  \note The order changes when entries are inserted or erased.
+   */
+  Entry*
+  getNext(const Entry& entry) const;
+
+  size_t
+  size() const;
+
+  /** \return number of slots of the current bucket array
+   */
+  size_t
+  getNSlots() const;
+
+  /** \return bytes allocated for bucket arrays
+   */
+  size_t
+  getNReservedBytes() const;
+
+  /** \return whether entries are being moved to a resized bucket array
+   */
+  bool
+  isResizing() const;
+
+public:
+  static const size_t BUCKET_SIZE = 64;
+  static const size_t N_SLOTS_PER_BUCKET = 6;
+  /// maximum fraction of occupied slots before the table grows
+  static const double MAX_LOAD_FACTOR;
+  /// fraction of occupied slots below which the table shrinks
+  static const double MIN_LOAD_FACTOR;
+  /// number of old buckets moved by each insert() or erase() while resizing
+  static const size_t N_MIGRATED_BUCKETS_PER_STEP = 4;
+
+private:
+  struct Bucket
+  {
+    uint16_t fingerprints[N_SLOTS_PER_BUCKET]; ///< 0 marks a free slot
+    uint16_t nOverflows; ///< number of stored entries whose home bucket precedes this one
+    uint16_t padding;
+    Entry* entries[N_SLOTS_PER_BUCKET];
+  };
+
+  /** \brief array of 2^n buckets, aligned to BUCKET_SIZE
+   */
+  struct BucketArray
+  {
+    BucketArray();
+
+    void
+    allocate(size_t nBuckets);
+
+    void
+    release();
+
+    Bucket* buckets;
+    size_t mask;
+    size_t nBuckets;
+    void* memory;
+  };
+
+  static uint16_t
+  getFingerprint(size_t hash);
+
+  static void
+  place(BucketArray& array, Entry& entry);
+
+  /** \brief find the bucket and slot of \p entry in \p array
+   */
+  static bool
+  locate(const BucketArray& array, const Entry& entry, size_t& bucket, size_t& slot);
+
+  /** \brief free the slot of \p entry, which is stored at \p bucket and \p slot of \p array
+   */
+  static void
+  remove(BucketArray& array, const Entry& entry, size_t bucket, size_t slot);
+
+  Entry*
+  scanFrom(const BucketArray* array, size_t bucket, size_t slot) const;
+
+  /** \brief start moving all entries into a new array of \p nBuckets buckets
+   */
+  void
+  startResize(size_t nBuckets);
+
+  /** \brief move entries of the next \p nBuckets old buckets
+   */
+  void
+  migrate(size_t nBuckets);
+
+private:
+  BucketArray m_buckets;
+  BucketArray m_oldBuckets; ///< being moved into m_buckets, empty if not resizing
+  size_t m_nMigratedBuckets;
+  size_t m_minNBuckets;
+  size_t m_nItems;
+};
+
+inline uint16_t
+Hashtable::getFingerprint(size_t hash)
+{
+  // bucket indexes are taken from the low bits
+  return static_cast<uint16_t>(hash >> (8 * sizeof(size_t) - 16)) | 1;
+}
+
+template<typename Predicate>
+inline Entry*
+Hashtable::find(size_t hash, const Predicate& pred) const
+{
+  uint16_t fingerprint = getFingerprint(hash);
+
+  for (const BucketArray* array = &m_buckets; array != nullptr;
+       array = (array == &m_buckets && isResizing()) ? &m_oldBuckets : nullptr) {
+    for (size_t i = hash & array->mask, nProbes = 0; nProbes < array->nBuckets;
+         i = (i + 1) & array->mask, ++nProbes) {
+      const Bucket& bucket = array->buckets[i];
+      for (size_t slot = 0; slot < N_SLOTS_PER_BUCKET; ++slot) {
+        if (bucket.fingerprints[slot] == fingerprint && pred(*bucket.entries[slot])) {
+          return bucket.entries[slot];
+        }
+      }
+      if (bucket.nOverflows == 0) {
+        break;
+      }
+    }
+  }
+  return nullptr;
+}
+
+inline size_t
+Hashtable::size() const
+{
+  return m_nItems;
+}
+
+inline size_t
+Hashtable::getNSlots() const
+{
+  return m_buckets.nBuckets * N_SLOTS_PER_BUCKET;
+}
+
+inline size_t
+Hashtable::getNReservedBytes() const
+{
+  return (m_buckets.nBuckets + m_oldBuckets.nBuckets) * sizeof(Bucket);
+}
+
+inline bool
+Hashtable::isResizing() const
+{
+  return m_oldBuckets.buckets != nullptr;
+}
+
+} // namespace name_tree
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_NAME_TREE_HASHTABLE_HPP
@@ -52,9 +52,11 @@ class Hash32
 {
 public:
   static size_t
-  compute(const char* buffer, size_t length)
+  compute(const char* buffer, size_t length, size_t seed)
   {
-    return static_cast<size_t>(CityHash32(buffer, length));
+    // boost::hash_combine
+    size_t hashValue = static_cast<size_t>(CityHash32(buffer, length));
+    return seed ^ (hashValue + 0x9e3779b9 + (seed << 6) + (seed >> 2));
   }
 };
 
@@ -62,9 +64,9 @@ class Hash64
 {
 public:
   static size_t
-  compute(const char* buffer, size_t length)
+  compute(const char* buffer, size_t length, size_t seed)
   {
-    return static_cast<size_t>(CityHash64(buffer, length));
+    return static_cast<size_t>(CityHash64WithSeed(buffer, length, seed));
   }
 };
 
@@ -77,13 +79,11 @@ computeHash(const Name& prefix)
   prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
 
   size_t hashValue = 0;
-  size_t hashUpdate = 0;
 
   for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
     {
       const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
+      hashValue = CityHash::compute(wireFormat, it->size(), hashValue);
     }
 
   return hashValue;
@@ -95,25 +95,32 @@ computeHashSet(const Name& prefix)
   prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
 
   size_t hashValue = 0;
-  size_t hashUpdate = 0;
 
   std::vector<size_t> hashValueSet;
+  hashValueSet.reserve(prefix.size() + 1);
   hashValueSet.push_back(hashValue);
 
   for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
     {
       const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
+      hashValue = CityHash::compute(wireFormat, it->size(), hashValue);
       hashValueSet.push_back(hashValue);
     }
 
   return hashValueSet;
 }
 
+HashSetTag::HashSetTag(const Name& name)
+  : m_nameWire(name.wireEncode())
+  , m_hashSet(computeHashSet(name))
+{
+}
+
 } // namespace name_tree
 
-NameTree::NameTree(size_t nBuckets)
+name_tree::StorageType NameTree::s_defaultStorageType = name_tree::STORAGE_CHAINED;
+
+NameTree::NameTree(size_t nBuckets, name_tree::StorageType storageType)
   : m_nItems(0)
   , m_nBuckets(nBuckets)
   , m_minNBuckets(nBuckets)
@@ -121,8 +128,18 @@ NameTree::NameTree(size_t nBuckets)
   , m_enlargeFactor(2)       // double the hash table size
   , m_shrinkLoadFactor(0.1) // less than 10% buckets loaded
   , m_shrinkFactor(0.5)     // reduce the number of buckets by half
+  , m_buckets(0)
+  , m_storageType(storageType)
   , m_endIterator(FULL_ENUMERATE_TYPE, *this, m_end)
 {
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      // the hash table resizes itself
+      m_hashtable.reset(new name_tree::Hashtable(nBuckets));
+      m_nBuckets = 0;
+      return;
+    }
+
   m_enlargeThreshold = static_cast<size_t>(m_enlargeLoadFactor *
                                           static_cast<double>(m_nBuckets));
 
@@ -138,6 +155,25 @@ NameTree::NameTree(size_t nBuckets)
 
 NameTree::~NameTree()
 {
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      // collect the entries first: releasing one may destroy its ancestors
+      std::vector<name_tree::Entry*> entries;
+      entries.reserve(m_hashtable->size());
+      for (name_tree::Entry* entry = m_hashtable->getFirst(); entry != 0;
+           entry = m_hashtable->getNext(*entry))
+        {
+          entries.push_back(entry);
+        }
+      for (name_tree::Entry* entry : entries)
+        {
+          // an entry is alive until its own reference is released, because its
+          // descendants are released after it or hold a reference to it
+          entry->m_hashtableRef.reset();
+        }
+      return;
+    }
+
   for (size_t i = 0; i < m_nBuckets; i++)
     {
       if (m_buckets[i] != 0) {
@@ -150,14 +186,17 @@ NameTree::~NameTree()
 
 // insert() is a private function, and called by only lookup()
 std::pair<shared_ptr<name_tree::Entry>, bool>
-NameTree::insert(const Name& prefix)
+NameTree::insert(const Name& name, size_t prefixLen, size_t hashValue, bool shouldSearch)
 {
-  NFD_LOG_TRACE("insert " << prefix);
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      return insertOpenAddressing(name, prefixLen, hashValue, shouldSearch);
+    }
 
-  size_t hashValue = name_tree::computeHash(prefix);
   size_t loc = hashValue % m_nBuckets;
 
-  NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue << "  location = " << loc);
+  NFD_LOG_TRACE("insert " << name << " prefixLen = " << prefixLen <<
+                " hash value = " << hashValue << "  location = " << loc);
 
   // Check if this Name has been stored
   name_tree::Node* node = m_buckets[loc];
@@ -165,9 +204,13 @@ NameTree::insert(const Name& prefix)
 
   for (node = m_buckets[loc]; node != 0; node = node->m_next)
     {
-      if (static_cast<bool>(node->m_entry))
+      if (shouldSearch && static_cast<bool>(node->m_entry))
         {
-          if (prefix == node->m_entry->m_prefix)
+          // compare the stored hash first; isPrefixOf() avoids making a copy of the prefix
+          const Name& entryPrefix = node->m_entry->m_prefix;
+          if (hashValue == node->m_entry->getHash() &&
+              entryPrefix.size() == prefixLen &&
+              entryPrefix.isPrefixOf(name))
             {
               return std::make_pair(node->m_entry, false); // false: old entry
             }
@@ -175,7 +218,8 @@ NameTree::insert(const Name& prefix)
       nodePrev = node;
     }
 
-  NFD_LOG_TRACE("Did not find " << prefix << ", need to insert it to the table");
+  NFD_LOG_TRACE("Did not find prefix of length " << prefixLen <<
+                ", need to insert it to the table");
 
   // If no bucket is empty occupied, we need to create a new node, and it is
   // linked from nodePrev
@@ -191,8 +235,8 @@ NameTree::insert(const Name& prefix)
       nodePrev->m_next = node;
     }
 
-  // Create a new Entry
-  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(prefix));
+  // Create a new Entry; this is the only place where the prefix is materialized
+  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(name.getPrefix(prefixLen)));
   entry->setHash(hashValue);
   node->m_entry = entry; // link the Entry to its Node
   entry->m_node = node; // link the node to Entry. Used in eraseEntryIfEmpty.
@@ -200,25 +244,66 @@ NameTree::insert(const Name& prefix)
   return std::make_pair(entry, true); // true: new entry
 }
 
+std::pair<shared_ptr<name_tree::Entry>, bool>
+NameTree::insertOpenAddressing(const Name& name, size_t prefixLen, size_t hashValue,
+                               bool shouldSearch)
+{
+  NFD_LOG_TRACE("insert " << name << " prefixLen = " << prefixLen <<
+                " hash value = " << hashValue);
+
+  if (shouldSearch)
+    {
+      name_tree::Entry* found = m_hashtable->find(hashValue,
+        [&] (const name_tree::Entry& entry) {
+          return hashValue == entry.getHash() &&
+                 entry.getPrefix().size() == prefixLen &&
+                 entry.getPrefix().isPrefixOf(name);
+        });
+      if (found != 0)
+        {
+          return std::make_pair(found->shared_from_this(), false); // false: old entry
+        }
+    }
+
+  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(name.getPrefix(prefixLen)));
+  entry->setHash(hashValue);
+  entry->m_hashtableRef = entry;
+  m_hashtable->insert(*entry);
+
+  return std::make_pair(entry, true); // true: new entry
+}
+
 // Name Prefix Lookup. Create Name Tree Entry if not found
 shared_ptr<name_tree::Entry>
 NameTree::lookup(const Name& prefix)
+{
+  // hash of every prefix of the name, computed in one pass over the components
+  return lookup(prefix, name_tree::computeHashSet(prefix));
+}
+
+shared_ptr<name_tree::Entry>
+NameTree::lookup(const Name& prefix, const std::vector<size_t>& hashValueSet)
 {
   NFD_LOG_TRACE("lookup " << prefix);
+  BOOST_ASSERT(hashValueSet.size() == prefix.size() + 1);
 
   shared_ptr<name_tree::Entry> entry;
   shared_ptr<name_tree::Entry> parent;
 
+  // Every stored entry has all its ancestors stored, so once one prefix is missing
+  // all longer prefixes are missing as well and need not be searched for.
+  bool shouldSearch = true;
+
   for (size_t i = 0; i <= prefix.size(); i++)
     {
-      Name temp = prefix.getPrefix(i);
-
       // insert() will create the entry if it does not exist.
-      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(temp);
+      std::pair<shared_ptr<name_tree::Entry>, bool> ret =
+        insert(prefix, i, hashValueSet[i], shouldSearch);
       entry = ret.first;
 
       if (ret.second == true)
         {
+          shouldSearch = false;
           m_nItems++; // Increase the counter
           entry->m_parent = parent;
 
@@ -228,7 +313,7 @@ NameTree::lookup(const Name& prefix)
             }
         }
 
-      if (m_nItems > m_enlargeThreshold)
+      if (m_storageType == name_tree::STORAGE_CHAINED && m_nItems > m_enlargeThreshold)
         {
           resize(m_enlargeFactor * m_nBuckets);
         }
@@ -245,6 +330,16 @@ NameTree::findExactMatch(const Name& prefix) const
   NFD_LOG_TRACE("findExactMatch " << prefix);
 
   size_t hashValue = name_tree::computeHash(prefix);
+
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      name_tree::Entry* found = m_hashtable->find(hashValue,
+        [&] (const name_tree::Entry& entry) {
+          return hashValue == entry.getHash() && prefix == entry.getPrefix();
+        });
+      return found != 0 ? found->shared_from_this() : shared_ptr<name_tree::Entry>();
+    }
+
   size_t loc = hashValue % m_nBuckets;
 
   NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue <<
@@ -273,15 +368,43 @@ NameTree::findExactMatch(const Name& prefix) const
 // Longest Prefix Match
 shared_ptr<name_tree::Entry>
 NameTree::findLongestPrefixMatch(const Name& prefix, const name_tree::EntrySelector& entrySelector) const
+{
+  return findLongestPrefixMatch(prefix, name_tree::computeHashSet(prefix), entrySelector);
+}
+
+shared_ptr<name_tree::Entry>
+NameTree::findLongestPrefixMatch(const Name& prefix,
+                                 const std::vector<size_t>& hashValueSet,
+                                 const name_tree::EntrySelector& entrySelector) const
 {
   NFD_LOG_TRACE("findLongestPrefixMatch " << prefix);
+  BOOST_ASSERT(hashValueSet.size() == prefix.size() + 1);
 
   shared_ptr<name_tree::Entry> entry;
-  std::vector<size_t> hashValueSet = name_tree::computeHashSet(prefix);
 
   size_t hashValue = 0;
   size_t loc = 0;
 
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      for (int i = static_cast<int>(prefix.size()); i >= 0; i--)
+        {
+          hashValue = hashValueSet[i];
+          name_tree::Entry* found = m_hashtable->find(hashValue,
+            [&] (const name_tree::Entry& entry) {
+              return hashValue == entry.getHash() &&
+                     entry.getPrefix().size() == static_cast<size_t>(i) &&
+                     entry.getPrefix().isPrefixOf(prefix) &&
+                     entrySelector(entry);
+            });
+          if (found != 0)
+            {
+              return found->shared_from_this();
+            }
+        }
+      return entry;
+    }
+
   for (int i = static_cast<int>(prefix.size()); i >= 0; i--)
     {
       hashValue = hashValueSet[i];
@@ -357,6 +480,19 @@ NameTree::eraseEntryIfEmpty(shared_ptr<name_tree::Entry> entry)
           BOOST_VERIFY(isFound == true);
         }
 
+      if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+        {
+          // the hash table resizes itself
+          m_hashtable->erase(*entry);
+          entry->m_hashtableRef.reset();
+          m_nItems--;
+
+          if (static_cast<bool>(parent))
+            eraseEntryIfEmpty(parent);
+
+          return true;
+        }
+
       // remove this Entry and its Name Tree Node
       name_tree::Node* node = entry->m_node;
       name_tree::Node* nodePrev = node->m_prev;
@@ -407,6 +543,17 @@ NameTree::fullEnumerate(const name_tree::EntrySelector& entrySelector) const
 {
   NFD_LOG_TRACE("fullEnumerate");
 
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING) {
+    for (name_tree::Entry* entry = m_hashtable->getFirst(); entry != 0;
+         entry = m_hashtable->getNext(*entry)) {
+      if (entrySelector(*entry)) {
+        const_iterator it(FULL_ENUMERATE_TYPE, *this, entry->shared_from_this(), entrySelector);
+        return {it, end()};
+      }
+    }
+    return {end(), end()};
+  }
+
   // find the first eligible entry
   for (size_t i = 0; i < m_nBuckets; i++) {
     for (name_tree::Node* node = m_buckets[i]; node != 0; node = node->m_next) {
@@ -453,6 +600,14 @@ NameTree::partialEnumerate(const Name& prefix,
 boost::iterator_range<NameTree::const_iterator>
 NameTree::findAllMatches(const Name& prefix,
                          const name_tree::EntrySelector& entrySelector) const
+{
+  return findAllMatches(prefix, name_tree::computeHashSet(prefix), entrySelector);
+}
+
+boost::iterator_range<NameTree::const_iterator>
+NameTree::findAllMatches(const Name& prefix,
+                         const std::vector<size_t>& hashValueSet,
+                         const name_tree::EntrySelector& entrySelector) const
 {
   NFD_LOG_TRACE("NameTree::findAllMatches" << prefix);
 
@@ -462,7 +617,8 @@ NameTree::findAllMatches(const Name& prefix,
   // For trie-like design, it could be more efficient by walking down the
   // trie from the root node.
 
-  shared_ptr<name_tree::Entry> entry = findLongestPrefixMatch(prefix, entrySelector);
+  shared_ptr<name_tree::Entry> entry = findLongestPrefixMatch(prefix, hashValueSet,
+                                                              entrySelector);
 
   if (static_cast<bool>(entry)) {
     const_iterator begin(FIND_ALL_MATCHES_TYPE, *this, entry, entrySelector);
@@ -530,6 +686,28 @@ NameTree::resize(size_t newNBuckets)
                                               static_cast<double>(m_nBuckets));
 }
 
+size_t
+NameTree::getNReservedBytes() const
+{
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      return m_hashtable->getNReservedBytes();
+    }
+  return m_nBuckets * sizeof(name_tree::Node*) + m_nItems * sizeof(name_tree::Node);
+}
+
+void
+NameTree::setDefaultStorageType(name_tree::StorageType storageType)
+{
+  s_defaultStorageType = storageType;
+}
+
+name_tree::StorageType
+NameTree::getDefaultStorageType()
+{
+  return s_defaultStorageType;
+}
+
 // For debugging
 void
 NameTree::dump(std::ostream& output) const
@@ -541,6 +719,25 @@ NameTree::dump(std::ostream& output) const
 
   using std::endl;
 
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      for (const name_tree::Entry* e = m_hashtable->getFirst(); e != 0;
+           e = m_hashtable->getNext(*e))
+        {
+          output << "Entry\t" << e->m_prefix.toUri() << endl;
+          output << "\t\tHash " << e->m_hash << endl;
+          if (static_cast<bool>(e->m_parent))
+            output << "\t\tparent->" << e->m_parent->m_prefix.toUri() << endl;
+          else
+            output << "\t\tROOT" << endl;
+          output << "\t\tchildren = " << e->m_children.size() << endl;
+        }
+      output << "Slot count = " << m_hashtable->getNSlots() << endl;
+      output << "Stored item = " << m_nItems << endl;
+      output << "--------------------------\n";
+      return;
+    }
+
   for (size_t i = 0; i < m_nBuckets; i++)
     {
       for (node = m_buckets[i]; node != 0; node = node->m_next)
@@ -612,6 +809,24 @@ NameTree::const_iterator::operator++()
 
   BOOST_ASSERT(m_entry != m_nameTree->m_end);
 
+  if (m_type == FULL_ENUMERATE_TYPE &&
+      m_nameTree->m_storageType == name_tree::STORAGE_OPEN_ADDRESSING)
+    {
+      const name_tree::Hashtable& hashtable = *m_nameTree->m_hashtable;
+      for (name_tree::Entry* entry = hashtable.getNext(*m_entry); entry != 0;
+           entry = hashtable.getNext(*entry))
+        {
+          if ((*m_entrySelector)(*entry))
+            {
+              m_entry = entry->shared_from_this();
+              return *this;
+            }
+        }
+
+      m_entry = m_nameTree->m_end;
+      return *this;
+    }
+
   if (m_type == FULL_ENUMERATE_TYPE) // fullEnumerate
     {
       // process the entries in the same bucket first
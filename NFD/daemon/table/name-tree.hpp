@@ -28,23 +28,91 @@
 
 #include "common.hpp"
 #include "name-tree-entry.hpp"
+#include "name-tree-hashtable.hpp"
 
 namespace nfd {
 namespace name_tree {
 
 /**
  * \brief Compute the hash value of the given name prefix's WIRE FORMAT
+ * \details The hash of each component is seeded with the hash of the preceding prefix, so
+ *          the value depends on the order of the components and identifies the whole name
+ *          (the root prefix hashes to 0).
  */
 size_t
 computeHash(const Name& prefix);
 
 /**
  * \brief Incrementally compute hash values
- * \return Return a vector of hash values, starting from the root prefix
+ * \return Return a vector of hash values, starting from the root prefix;
+ *         element i equals computeHash(prefix.getPrefix(i))
  */
 std::vector<size_t>
 computeHashSet(const Name& prefix);
 
+/**
+ * \brief hash values of all prefixes of a packet's Name, as returned by computeHashSet()
+ *
+ * Attached to an Interest or Data by getHashSet(), so that the NameTree lookups of the PIT
+ * and the Dead Nonce List check of one packet share a single pass over its Name.
+ */
+class HashSetTag : public ndn::Tag
+{
+public:
+  static size_t
+  getTypeId()
+  {
+    return 0x9f21d24c; // md5("NameTreeHashSetTag")[0:8]
+  }
+
+  explicit
+  HashSetTag(const Name& name);
+
+  /** \return whether the hash values were computed from \p name
+   *  \details Compares the wire encoding by identity, which is cheap and detects a Name
+   *           replaced or modified after the tag was attached.
+   */
+  bool
+  isFor(const Name& name) const;
+
+  const std::vector<size_t>&
+  get() const;
+
+private:
+  Block m_nameWire; ///< keeps the buffer compared by isFor() alive
+  std::vector<size_t> m_hashSet;
+};
+
+inline bool
+HashSetTag::isFor(const Name& name) const
+{
+  const Block& nameWire = name.wireEncode();
+  return nameWire.wire() == m_nameWire.wire() && nameWire.size() == m_nameWire.size();
+}
+
+inline const std::vector<size_t>&
+HashSetTag::get() const
+{
+  return m_hashSet;
+}
+
+/**
+ * \brief get the hash values of all prefixes of \p packet's Name
+ * \details They are computed on the first call and cached on the packet in a HashSetTag.
+ * \tparam Packet Interest or Data
+ */
+template<typename Packet>
+const std::vector<size_t>&
+getHashSet(const Packet& packet)
+{
+  shared_ptr<HashSetTag> tag = packet.template getTag<HashSetTag>();
+  if (tag == nullptr || !tag->isFor(packet.getName())) {
+    tag = make_shared<HashSetTag>(packet.getName());
+    packet.setTag(tag);
+  }
+  return tag->get();
+}
+
 /// a predicate to accept or reject an Entry in find operations
 typedef function<bool (const Entry& entry)> EntrySelector;
 
@@ -63,6 +131,20 @@ struct AnyEntry {
   }
 };
 
+/**
+ * \brief hash table layout of a NameTree
+ */
+enum StorageType {
+  /** \brief array of bucket pointers to doubly linked lists of Nodes, with full rehash
+   *  on resize
+   */
+  STORAGE_CHAINED,
+  /** \brief open addressing with cache line sized buckets and incremental resize,
+   *  see name_tree::Hashtable
+   */
+  STORAGE_OPEN_ADDRESSING
+};
+
 struct AnyEntrySubTree {
   std::pair<bool, bool>
   operator()(const Entry& entry)
@@ -81,8 +163,13 @@ class NameTree : noncopyable
 public:
   class const_iterator;
 
+  /**
+   * \param nBuckets initial number of buckets; number of slots with STORAGE_OPEN_ADDRESSING
+   * \param storageType hash table layout
+   */
   explicit
-  NameTree(size_t nBuckets = 1024);
+  NameTree(size_t nBuckets = 1024,
+           name_tree::StorageType storageType = NameTree::getDefaultStorageType());
 
   ~NameTree();
 
@@ -101,12 +188,34 @@ public: // information
   size_t
   getNBuckets() const;
 
+  name_tree::StorageType
+  getStorageType() const;
+
+  /**
+   * \brief Get the memory used by the hash table in bytes
+   * \details Counts bucket arrays and Nodes, but neither the entries nor allocator overhead.
+   */
+  size_t
+  getNReservedBytes() const;
+
   /**
    * \brief Dump all the information stored in the Name Tree for debugging.
    */
   void
   dump(std::ostream& output) const;
 
+public: // storage selection
+  /** \brief set the storage type of NameTrees constructed without an explicit one
+   *  (STORAGE_CHAINED by default)
+   *  \details Intended for comparing both layouts in simulations, whose forwarders
+   *  construct their NameTree internally (see tests/other/ndn-test.cpp).
+   */
+  static void
+  setDefaultStorageType(name_tree::StorageType storageType);
+
+  static name_tree::StorageType
+  getDefaultStorageType();
+
 public: // mutation
   /**
    * \brief Look for the Name Tree Entry that contains this name prefix.
@@ -121,6 +230,13 @@ public: // mutation
   shared_ptr<name_tree::Entry>
   lookup(const Name& prefix);
 
+  /**
+   * \brief Same as lookup(prefix), with the hash values of all prefixes already computed
+   * \param hashSet name_tree::computeHashSet(prefix), e.g. from name_tree::getHashSet
+   */
+  shared_ptr<name_tree::Entry>
+  lookup(const Name& prefix, const std::vector<size_t>& hashSet);
+
   /**
    * \brief Delete a Name Tree Entry if this entry is empty.
    * \param entry The entry to be deleted if empty.
@@ -168,6 +284,17 @@ public: // matching
                          const name_tree::EntrySelector& entrySelector =
                          name_tree::AnyEntry()) const;
 
+  /**
+   * \brief Same as findLongestPrefixMatch(prefix, entrySelector), with the hash values of
+   * all prefixes already computed
+   * \param hashSet name_tree::computeHashSet(prefix), e.g. from name_tree::getHashSet
+   */
+  shared_ptr<name_tree::Entry>
+  findLongestPrefixMatch(const Name& prefix,
+                         const std::vector<size_t>& hashSet,
+                         const name_tree::EntrySelector& entrySelector =
+                         name_tree::AnyEntry()) const;
+
   shared_ptr<name_tree::Entry>
   findLongestPrefixMatch(shared_ptr<name_tree::Entry> entry,
                          const name_tree::EntrySelector& entrySelector =
@@ -191,6 +318,15 @@ public: // matching
   findAllMatches(const Name& prefix,
                  const name_tree::EntrySelector& entrySelector = name_tree::AnyEntry()) const;
 
+  /** \brief Same as findAllMatches(prefix, entrySelector), with the hash values of all
+   *  prefixes already computed
+   *  \param hashSet name_tree::computeHashSet(prefix), e.g. from name_tree::getHashSet
+   */
+  boost::iterator_range<const_iterator>
+  findAllMatches(const Name& prefix,
+                 const std::vector<size_t>& hashSet,
+                 const name_tree::EntrySelector& entrySelector = name_tree::AnyEntry()) const;
+
 public: // enumeration
   /** \brief Enumerate all entries, optionally filtered by an EntrySelector.
    *  \return an unspecified type that have .begin() and .end() methods
@@ -313,19 +449,33 @@ private:
   size_t                        m_shrinkThreshold;
   double                        m_shrinkFactor;
   name_tree::Node**             m_buckets; // Name Tree Buckets in the NPHT
+  name_tree::StorageType        m_storageType;
+  unique_ptr<name_tree::Hashtable> m_hashtable; // used instead of m_buckets if open addressing
   shared_ptr<name_tree::Entry>  m_end;
   const_iterator                m_endIterator;
 
+  static name_tree::StorageType s_defaultStorageType;
+
   /**
    * \brief Create a Name Tree Entry if it does not exist, or return the existing
    * Name Tree Entry address.
    * \details Called by lookup() only.
+   * \param name the name whose prefix is inserted
+   * \param prefixLen number of components of \p name in the prefix
+   * \param hashValue hash of the prefix, as computed by computeHashSet(name)
+   * \param shouldSearch false if the prefix is known not to be stored
    * \return The first item is the Name Tree Entry address, the second item is
    * a bool value indicates whether this is an old entry (false) or a new
    * entry (true).
    */
   std::pair<shared_ptr<name_tree::Entry>, bool>
-  insert(const Name& prefix);
+  insert(const Name& name, size_t prefixLen, size_t hashValue, bool shouldSearch);
+
+  /**
+   * \brief insert() for STORAGE_OPEN_ADDRESSING
+   */
+  std::pair<shared_ptr<name_tree::Entry>, bool>
+  insertOpenAddressing(const Name& name, size_t prefixLen, size_t hashValue, bool shouldSearch);
 };
 
 inline NameTree::const_iterator::~const_iterator()
@@ -341,9 +491,18 @@ NameTree::size() const
 inline size_t
 NameTree::getNBuckets() const
 {
+  if (m_storageType == name_tree::STORAGE_OPEN_ADDRESSING) {
+    return m_hashtable->getNSlots();
+  }
   return m_nBuckets;
 }
 
+inline name_tree::StorageType
+NameTree::getStorageType() const
+{
+  return m_storageType;
+}
+
 inline shared_ptr<name_tree::Entry>
 NameTree::get(const fib::Entry& fibEntry) const
 {
@@ -30,6 +30,7 @@
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
 #include "core/scheduler.hpp"
+#include "core/small-vector.hpp"
 
 namespace nfd {
 
@@ -42,12 +43,18 @@ class Entry;
 namespace pit {
 
 /** \brief represents an unordered collection of InRecords
+ *
+ *  Most entries have one or two InRecords, which are stored inside the entry.
+ *  Inserting or deleting a record invalidates iterators.
  */
-typedef std::list< InRecord>  InRecordCollection;
+typedef SmallVector<InRecord, 2> InRecordCollection;
 
 /** \brief represents an unordered collection of OutRecords
+ *
+ *  Most entries have one or two OutRecords, which are stored inside the entry.
+ *  Inserting or deleting a record invalidates iterators.
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef SmallVector<OutRecord, 2> OutRecordCollection;
 
 /** \brief indicates where duplicate Nonces are found
  */
@@ -165,8 +172,8 @@ public: // OutRecord
   hasUnexpiredOutRecords() const;
 
 public:
-  scheduler::EventId m_unsatisfyTimer;
-  scheduler::EventId m_stragglerTimer;
+  scheduler::Timer m_unsatisfyTimer;
+  scheduler::Timer m_stragglerTimer;
   
   // PIT Entry marked as congested or NACKed.
   bool m_congMark;
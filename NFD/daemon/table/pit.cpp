@@ -51,6 +51,8 @@ static_assert(std::is_default_constructible<Pit::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Pit::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
+bool Pit::s_shouldUsePool = true;
+
 Pit::Pit(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
@@ -66,7 +68,8 @@ Pit::insert(const Interest& interest)
 {
   // first lookup() the Interest Name in the NameTree, which will creates all
   // the intermedia nodes, starting from the shortest prefix.
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.lookup(interest.getName());
+  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.lookup(interest.getName(),
+                                                                 name_tree::getHashSet(interest));
   BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
 
   const std::vector<shared_ptr<pit::Entry>>& pitEntries = nameTreeEntry->getPitEntries();
@@ -81,7 +84,13 @@ Pit::insert(const Interest& interest)
     return { *it, false };
   }
 
-  shared_ptr<pit::Entry> entry = make_shared<pit::Entry>(interest);
+  shared_ptr<pit::Entry> entry;
+  if (s_shouldUsePool) {
+    entry = std::allocate_shared<pit::Entry>(PoolAllocator<pit::Entry>(), interest);
+  }
+  else {
+    entry = make_shared<pit::Entry>(interest);
+  }
   nameTreeEntry->insertPitEntry(entry);
   m_nItems++;
   return { entry, true };
@@ -90,7 +99,7 @@ Pit::insert(const Interest& interest)
 pit::DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
-  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(),
+  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), name_tree::getHashSet(data),
     [] (const name_tree::Entry& entry) { return entry.hasPitEntries(); });
 
   pit::DataMatchResult matches;
@@ -116,6 +125,18 @@ Pit::erase(shared_ptr<pit::Entry> pitEntry)
   --m_nItems;
 }
 
+void
+Pit::setEntryPooling(bool shouldUsePool)
+{
+  s_shouldUsePool = shouldUsePool;
+}
+
+const FixedSizePool&
+Pit::getEntryPool()
+{
+  return PoolAllocator<pit::Entry>::getPool();
+}
+
 Pit::const_iterator
 Pit::begin() const
 {
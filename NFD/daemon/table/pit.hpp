@@ -28,6 +28,7 @@
 
 #include "name-tree.hpp"
 #include "pit-entry.hpp"
+#include "core/pool-allocator.hpp"
 
 namespace nfd {
 namespace pit {
@@ -78,6 +79,21 @@ public:
   void
   erase(shared_ptr<pit::Entry> pitEntry);
 
+public: // allocation
+  /** \brief enables or disables pooled allocation of PIT entries (enabled by default)
+   *
+   *  When enabled, an entry and its shared_ptr control block are taken from a FixedSizePool
+   *  shared by all PITs, instead of a separate heap allocation per entry.
+   *  Intended for comparing both schemes (see tests/other/ndn-test.cpp).
+   */
+  static void
+  setEntryPooling(bool shouldUsePool);
+
+  /** \return the pool that holds pooled PIT entries
+   */
+  static const FixedSizePool&
+  getEntryPool();
+
 public: // enumeration
   class const_iterator;
 
@@ -137,6 +153,8 @@ public: // enumeration
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  static bool s_shouldUsePool;
 };
 
 inline size_t
@@ -39,6 +39,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -113,6 +114,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
     entry = make_shared<Entry>(prefix);
     nte->setStrategyChoiceEntry(entry);
     ++m_nItems;
+    ++m_generation;
     NFD_LOG_TRACE("insert(" << prefix << ") new entry " << strategy->getName());
   }
 
@@ -144,6 +146,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(shared_ptr<Entry>());
   m_nameTree.eraseEntryIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -181,13 +184,17 @@ StrategyChoice::findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const
   if (static_cast<bool>(entry))
     return entry->getStrategy();
 
-  nte = m_nameTree.findLongestPrefixMatch(nte,
-    [] (const name_tree::Entry& entry) {
-      return static_cast<bool>(entry.getStrategyChoiceEntry());
-    });
+  name_tree::LpmCache& cache = nte->getLpmCache(name_tree::LPM_STRATEGY_CHOICE);
+  if (cache.generation != m_generation) {
+    cache.match = m_nameTree.findLongestPrefixMatch(nte,
+      [] (const name_tree::Entry& entry) {
+        return static_cast<bool>(entry.getStrategyChoiceEntry());
+      }).get();
+    cache.generation = m_generation;
+  }
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return nte->getStrategyChoiceEntry()->getStrategy();
+  BOOST_ASSERT(cache.match != 0);
+  return cache.match->getStrategyChoiceEntry()->getStrategy();
 }
 
 Strategy&
@@ -219,6 +226,7 @@ StrategyChoice::setDefaultStrategy(shared_ptr<Strategy> strategy)
   shared_ptr<Entry> entry = make_shared<Entry>(Name());
   nte->setStrategyChoiceEntry(entry);
   ++m_nItems;
+  ++m_generation;
   NFD_LOG_INFO("setDefaultStrategy " << strategy->getName());
 
   entry->setStrategy(*strategy);
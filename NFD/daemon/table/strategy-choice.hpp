@@ -164,6 +164,9 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  /// changes whenever an entry is attached to or detached from the NameTree,
+  /// see name_tree::LpmCache
+  uint64_t m_generation;
 
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
@@ -150,7 +150,7 @@ void
 ConsumerCC::ScheduleNextPacket()
 {
   if (m_cwnd <= static_cast<uint32_t>(0)) {
-    std::cout << "Cwnd ran empty! Scheduling new packet!\n";
+    NS_LOG_DEBUG("Cwnd ran empty! Scheduling new packet!");
     Simulator::Remove(m_sendEvent);
     m_sendEvent = Simulator::Schedule(
         Seconds(std::min<double>(0.5, m_rtt->RetransmitTimeout().ToDouble(Time::S))),
@@ -192,25 +192,12 @@ ConsumerCC::getTagCongMarked(shared_ptr<const Data> contentObject)
   }
 }
 
-shared_ptr<::ns3::ndn::Ns3CCTag>
+const ::ns3::ndn::Ns3CCTag*
 ConsumerCC::getCCTag(shared_ptr<const Data> contentObject)
 {
   auto tag = contentObject->getTag<Ns3PacketTag>();
-  ns3::ndn::Ns3CCTag tempTag;
-  if (tag != nullptr && tag->getPacket()->PeekPacketTag(tempTag)) {
-    ns3::Ptr<const ns3::Packet> pkt = tag->getPacket();
-    shared_ptr<ns3::ndn::Ns3CCTag> ccTag = make_shared<ns3::ndn::Ns3CCTag>();
-    auto it = pkt->GetPacketTagIterator();
-    int i = 0;
-    while (it.HasNext()) {
-      i++;
-      auto n = it.Next();
-      if (n.GetTypeId() == Ns3CCTag::GetTypeId()) {
-        n.GetTag(*ccTag);
-        break;
-      }
-    }
-    return ccTag;
+  if (tag != nullptr) {
+    return tag->getCCTag();
   }
   // Error.
   return nullptr;
@@ -219,9 +206,8 @@ ConsumerCC::getCCTag(shared_ptr<const Data> contentObject)
 void
 ConsumerCC::windowDecrease(bool setInitialWindow)
 {
-  auto now = time::steady_clock::now().time_since_epoch();
-  std::cout << time::duration_cast<time::milliseconds>(now) << " Node " << this->GetNode()->GetId()
-      << " Cwnd decrease: " << m_cwnd << " -> " << m_cwnd * m_beta << "\n";
+  NS_LOG_DEBUG("Node " << this->GetNode()->GetId() << " Cwnd decrease: " << m_cwnd << " -> "
+      << m_cwnd * m_beta);
   bicDecrease(setInitialWindow);
 }
 
@@ -248,7 +234,7 @@ ConsumerCC::OnData(shared_ptr<const Data> contentObject)
 
   int nackType = getNackType(contentObject);
   if (nackType > 0) {
-    std::cout << " Consumer got NACK for seq: " << sequenceNumber << " -> Retx!\n";
+    NS_LOG_DEBUG("Consumer got NACK for seq: " << sequenceNumber << " -> Retx!");
     Consumer::OnNack(sequenceNumber);
   }
   else {
@@ -285,10 +271,8 @@ ConsumerCC::OnData(shared_ptr<const Data> contentObject)
 void
 ConsumerCC::OnTimeout(uint32_t sequenceNumber)
 {
-  auto now = time::steady_clock::now().time_since_epoch();
-  std::cout << time::duration_cast<time::milliseconds>(now) << " Timeout packet "
-      << sequenceNumber << ", RTO: " << m_rtt->RetransmitTimeout().ToInteger(Time::MS)
-      << " ms\n";
+  NS_LOG_DEBUG("Timeout packet " << sequenceNumber << ", RTO: "
+      << m_rtt->RetransmitTimeout().ToInteger(Time::MS) << " ms");
 
   // Reduce number of in flight packets.
   if (m_inFlight > static_cast<uint32_t>(0)) {
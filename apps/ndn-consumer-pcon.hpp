@@ -86,7 +86,7 @@ private:
   void
   SetMaxSize(double size);
 
-  shared_ptr<::ns3::ndn::Ns3CCTag>
+  const ::ns3::ndn::Ns3CCTag*
   getCCTag(shared_ptr<const Data> contentObject);
 
   bool
@@ -21,6 +21,7 @@
 #include "ns3/log.h"
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -65,7 +66,12 @@ Producer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&Producer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&Producer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("UseDataTemplate",
+                    "Encode the Data fields other than the Name once at start and copy them into "
+                    "every Data packet.  Attributes changed after start are ignored",
+                    BooleanValue(false), MakeBooleanAccessor(&Producer::m_shouldUseDataTemplate),
+                    MakeBooleanChecker());
   return tid;
 }
 
@@ -82,6 +88,12 @@ Producer::StartApplication()
   App::StartApplication();
 
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
+
+  if (m_shouldUseDataTemplate) {
+    Data prototype;
+    FillData(prototype);
+    m_dataTemplate.reset(new DataTemplate(prototype));
+  }
 }
 
 void
@@ -89,9 +101,31 @@ Producer::StopApplication()
 {
   NS_LOG_FUNCTION_NOARGS();
 
+  m_dataTemplate.reset();
+
   App::StopApplication();
 }
 
+void
+Producer::FillData(Data& data) const
+{
+  data.setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
+
+  data.setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+
+  Signature signature;
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+
+  if (m_keyLocator.size() > 0) {
+    signatureInfo.setKeyLocator(m_keyLocator);
+  }
+
+  signature.setInfo(signatureInfo);
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
+
+  data.setSignature(signature);
+}
+
 void
 Producer::OnInterest(shared_ptr<const Interest> interest)
 {
@@ -106,29 +140,22 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   // dataName.append(m_postfix);
   // dataName.appendVersion();
 
-  auto data = make_shared<Data>();
-  data->setName(dataName);
-  data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
-
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
-
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
-
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
+  shared_ptr<Data> data;
+  if (m_dataTemplate != nullptr) {
+    // already encoded
+    data = m_dataTemplate->makeData(dataName);
   }
+  else {
+    data = make_shared<Data>();
+    data->setName(dataName);
+    FillData(*data);
 
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
-
-  data->setSignature(signature);
+    // to create real wire encoding
+    data->wireEncode();
+  }
 
   NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
 
-  // to create real wire encoding
-  data->wireEncode();
-
   m_transmittedDatas(data, this, m_face);
   m_face->onReceiveData(*data);
 }
@@ -25,6 +25,8 @@
 #include "ndn-app.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-data-template.hpp"
+
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
 
@@ -59,6 +61,13 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+private:
+  /**
+   * @brief Set all fields of @p data except the Name from the attributes
+   */
+  void
+  FillData(Data& data) const;
+
 private:
   Name m_prefix;
   Name m_postfix;
@@ -67,6 +76,9 @@ private:
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  bool m_shouldUseDataTemplate;
+  std::unique_ptr<DataTemplate> m_dataTemplate; ///< built at start if m_shouldUseDataTemplate
 };
 
 } // namespace ndn
@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+## -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+#
+# Copyright (c) 2016 Klaus Schneider, The University of Arizona
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 2 as
+# published by the Free Software Foundation;
+#
+# Converts the binary forwarding percentage trace written by PconStrategy
+# with FWPERC_FORMAT=binary (results/fwperc.bin, see
+# NFD/daemon/fw/fw-perc-trace.hpp) into the table format of results/fwperc.txt.
+#
+#   ./fwperc-to-csv.py results/fwperc.bin > results/fwperc.txt
+#   ./fwperc-to-csv.py --separator=, results/fwperc.bin > results/fwperc.csv
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'FWP1'
+RECORD = struct.Struct('=dIIQd')   # time, node, prefix id, face id, fw perc
+UINT32 = struct.Struct('=I')
+
+def readUint32(f):
+    data = f.read(UINT32.size)
+    if len(data) < UINT32.size:
+        return None
+    return UINT32.unpack(data)[0]
+
+def convert(f, out, sep):
+    if f.read(len(MAGIC)) != MAGIC:
+        raise SystemExit("Not a forwarding percentage trace")
+
+    out.write(sep.join(["Time", "Node", "Prefix", "FaceId", "type", "value"]) + "\n")
+
+    prefixes = []
+    while True:
+        nNewPrefixes = readUint32(f)
+        if nNewPrefixes is None:
+            break
+        for i in range(nNewPrefixes):
+            length = readUint32(f)
+            prefixes.append(f.read(length).decode('utf-8'))
+
+        nRecords = readUint32(f)
+        for i in range(nRecords):
+            time, node, prefixId, faceId, fwPerc = RECORD.unpack(f.read(RECORD.size))
+            out.write(sep.join(["%g" % time, str(node), prefixes[prefixId], str(faceId),
+                                "forwperc", "%g" % fwPerc]) + "\n")
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Convert binary fwperc trace to text")
+    parser.add_argument('input', help="binary trace file (results/fwperc.bin)")
+    parser.add_argument('--separator', default='\t', help="column separator (default: tab)")
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        convert(f, sys.stdout, args.separator)
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+## -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 2 as
+# published by the Free Software Foundation;
+#
+# Converts the binary trace written by ndn::TableStatsTracer (see
+# utils/tracers/ndn-table-stats-tracer.hpp) into a table with one line per
+# node and sample.
+#
+#   ./table-stats-to-csv.py table-stats.bin > table-stats.txt
+#   ./table-stats-to-csv.py --separator=, table-stats.bin > table-stats.csv
+#   ./table-stats-to-csv.py --columns=Pit,Cs table-stats.bin
+
+import argparse
+import array
+import struct
+import sys
+
+MAGIC = b'TST1'
+UINT32 = struct.Struct('=I')
+
+def readUint32(f):
+    data = f.read(UINT32.size)
+    if len(data) < UINT32.size:
+        return None
+    return UINT32.unpack(data)[0]
+
+def readColumn(f, typecode, nRows):
+    column = array.array(typecode)
+    data = f.read(column.itemsize * nRows)
+    if len(data) < column.itemsize * nRows:
+        raise SystemExit("Truncated table statistics trace")
+    if hasattr(column, 'frombytes'):
+        column.frombytes(data)
+    else: # Python 2
+        column.fromstring(data)
+    return column
+
+def convert(f, out, sep, selected):
+    if f.read(len(MAGIC)) != MAGIC:
+        raise SystemExit("Not a table statistics trace")
+
+    names = []
+    for i in range(readUint32(f)):
+        length = readUint32(f)
+        names.append(f.read(length).decode('utf-8'))
+
+    indexes = range(len(names))
+    if selected:
+        unknown = [name for name in selected if name not in names]
+        if unknown:
+            raise SystemExit("Unknown columns: %s (available: %s)" %
+                             (", ".join(unknown), ", ".join(names)))
+        indexes = [names.index(name) for name in selected]
+
+    out.write(sep.join(["Time", "Node"] + [names[i] for i in indexes]) + "\n")
+
+    while True:
+        nRows = readUint32(f)
+        if nRows is None:
+            break
+        times = readColumn(f, 'd', nRows)
+        nodes = readColumn(f, 'I', nRows)
+        columns = [readColumn(f, 'Q', nRows) for name in names]
+        for row in range(nRows):
+            out.write(sep.join(["%g" % times[row], str(nodes[row])] +
+                               [str(columns[i][row]) for i in indexes]) + "\n")
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Convert binary table statistics trace to text")
+    parser.add_argument('input', help="binary trace file written by TableStatsTracer")
+    parser.add_argument('--separator', default='\t', help="column separator (default: tab)")
+    parser.add_argument('--columns', default='',
+                        help="comma-separated value columns to keep (default: all)")
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        convert(f, sys.stdout, args.separator,
+                [name for name in args.columns.split(',') if name])
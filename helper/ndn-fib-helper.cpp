@@ -39,15 +39,56 @@
 #include "ns3/data-rate.h"
 
 #include "daemon/mgmt/fib-manager.hpp"
+#include "daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 
+#include <chrono>
 
 namespace ns3 {
 namespace ndn {
 
 NS_LOG_COMPONENT_DEFINE("ndn.FibHelper");
 
+static FibHelper::InstallStats g_installStats = {0, 0.0};
+
+/**
+ * \brief Adds the wall-clock time of its lifetime and \p nRoutes to g_installStats
+ */
+class InstallTimer
+{
+public:
+  explicit
+  InstallTimer(size_t nRoutes)
+    : m_nRoutes(nRoutes)
+    , m_begin(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~InstallTimer()
+  {
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - m_begin;
+    g_installStats.nRoutes += m_nRoutes;
+    g_installStats.seconds += duration.count();
+  }
+
+private:
+  size_t m_nRoutes;
+  std::chrono::steady_clock::time_point m_begin;
+};
+
+const FibHelper::InstallStats&
+FibHelper::GetInstallStats()
+{
+  return g_installStats;
+}
+
+void
+FibHelper::ResetInstallStats()
+{
+  g_installStats = {0, 0.0};
+}
+
 void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
@@ -100,9 +141,30 @@ FibHelper::AddRoute(Ptr<Node> node, const ::ndn::Name& prefix, shared_ptr<Face>
   parameters.setFaceId(face->getId());
   parameters.setCost(metric);
 
+  InstallTimer timer(1);
   AddNextHop(parameters, node);
 }
 
+void
+FibHelper::AddRoutes(Ptr<Node> node, const std::vector<Route>& routes)
+{
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+  InstallTimer timer(routes.size());
+  nfd::Fib& fib = ndn->getForwarder()->getFib();
+  for (const Route& route : routes) {
+    NS_LOG_LOGIC("[" << node->GetId() << "]$ route add " << route.prefix << " via "
+                     << route.face->getLocalUri() << " metric " << route.metric);
+    NS_ASSERT_MSG(ndn->getFaceById(route.face->getId()) == route.face,
+                  "Face with ID [" << route.face->getId() << "] does not exist on node ["
+                                   << node->GetId() << "]");
+
+    // same as FibManager::addNextHop
+    fib.insert(route.prefix).first->addNextHop(route.face, static_cast<uint64_t>(route.metric));
+  }
+}
+
 void
 FibHelper::AddRoute(Ptr<Node> node, const ::ndn::Name& prefix, uint32_t faceId, int32_t metric)
 {
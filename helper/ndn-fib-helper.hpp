@@ -41,10 +41,37 @@ using ::ndn::nfd::ControlParameters;
  *
  * The FIB helper interacts with the FIB manager of NFD by sending special Interest
  * commands to the manager in order to add/remove a next hop from FIB entries or add
- * routes to the FIB manually (manual configuration of FIB).
+ * routes to the FIB manually (manual configuration of FIB).  AddRoutes adds many routes
+ * to the FIB of a node directly, without commands.
  */
 class FibHelper {
 public:
+  /**
+   * \brief Forwarding entry to be added by AddRoutes
+   */
+  struct Route
+  {
+    Route(const Name& prefix, shared_ptr<Face> face, int32_t metric)
+      : prefix(prefix)
+      , face(face)
+      , metric(metric)
+    {
+    }
+
+    Name prefix;
+    shared_ptr<Face> face;
+    int32_t metric;
+  };
+
+  /**
+   * \brief Number of next hops added to FIBs and wall-clock time spent adding them
+   */
+  struct InstallStats
+  {
+    uint64_t nRoutes;
+    double seconds;
+  };
+
   /**
    * \brief Add forwarding entry to FIB
    *
@@ -102,6 +129,27 @@ public:
   AddRoute(const std::string& nodeName, const ::ndn::Name& prefix, const std::string& otherNodeName,
            int32_t metric);
 
+  /**
+   * \brief Add forwarding entries to FIB
+   *
+   * The result is the same as calling AddRoute for each route, but the FIB of the node is
+   * modified directly instead of through a signed FIB management command per route.
+   *
+   * \param node   Node
+   * \param routes Routes, whose faces must belong to the node
+   */
+  static void
+  AddRoutes(Ptr<Node> node, const std::vector<Route>& routes);
+
+  /**
+   * \brief Next hops added by AddRoute and AddRoutes since the start or the last reset
+   */
+  static const InstallStats&
+  GetInstallStats();
+
+  static void
+  ResetInstallStats();
+
   /**
    * \brief remove forwarding entry in FIB
    *
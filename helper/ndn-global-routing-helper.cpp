@@ -29,6 +29,7 @@
 #include "helper/ndn-fib-helper.hpp"
 #include "model/ndn-net-device-face.hpp"
 #include "model/ndn-global-router.hpp"
+#include "helper/ndn-global-routing-snapshot.hpp"
 
 #include "daemon/table/fib.hpp"
 #include "daemon/fw/forwarder.hpp"
@@ -46,23 +47,41 @@
 #include "ns3/node-list.h"
 #include "ns3/channel-list.h"
 #include "ns3/object-factory.h"
+#include "ns3/simulator.h"
 
 #include <boost/lexical_cast.hpp>
-#include <boost/foreach.hpp>
-#include <boost/concept/assert.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/thread/thread.hpp>
 
-#include <unordered_map>
-
-#include "boost-graph-ndn-global-routing-helper.hpp"
-
-#include <math.h>
+#include <chrono>
+#include <map>
+#include <memory>
 
 NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingHelper");
 
 namespace ns3 {
 namespace ndn {
 
+uint32_t GlobalRoutingHelper::m_nThreads = 0;
+bool GlobalRoutingHelper::m_isIncremental = false;
+GlobalRoutingHelper::UpdateStats GlobalRoutingHelper::m_lastUpdateStats = {0, 0, 0, 0, 0, 0.0};
+
+/**
+ * \brief Snapshot and shortest-path trees kept for GlobalRoutingHelper::UpdateRoutes
+ */
+struct IncrementalState
+{
+  GlobalRoutingSnapshot snapshot;
+  std::vector<GlobalRoutingSnapshot::TreeList> trees;
+};
+
+static std::unique_ptr<IncrementalState> g_incrementalState;
+
+static void
+ClearIncrementalState()
+{
+  g_incrementalState.reset();
+}
+
 void
 GlobalRoutingHelper::Install(Ptr<Node> node)
 {
@@ -214,176 +233,201 @@ GlobalRoutingHelper::AddOriginsForAll()
   }
 }
 
+/**
+ * \brief Log the routes installed since \p statsBefore was taken
+ */
+static void
+LogInstallStats(const FibHelper::InstallStats& statsBefore)
+{
+  const FibHelper::InstallStats& stats = FibHelper::GetInstallStats();
+  NS_LOG_INFO("Installed " << stats.nRoutes - statsBefore.nRoutes << " routes in "
+              << stats.seconds - statsBefore.seconds << "s");
+}
+
 void
-GlobalRoutingHelper::CalculateRoutes()
+GlobalRoutingHelper::SetNThreads(uint32_t nThreads)
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
+  m_nThreads = nThreads;
+}
 
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
+uint32_t
+GlobalRoutingHelper::GetNThreads()
+{
+  if (m_nThreads == 0) {
+    return std::max(boost::thread::hardware_concurrency(), 1u);
+  }
+  return m_nThreads;
+}
 
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+/**
+ * \brief Compute next hops from every node of \p snapshot with \p compute, then install them
+ *
+ * Only the computation is spread over threads; routes are installed on the simulation thread in
+ * NodeList order.  With \p isIncremental, the snapshot and its trees are kept for UpdateRoutes.
+ */
+static void
+CalculateAndInstallRoutes(GlobalRoutingSnapshot::ComputeFunction compute, bool isIncremental)
+{
+  FibHelper::InstallStats statsBefore = FibHelper::GetInstallStats();
+
+  std::unique_ptr<IncrementalState> state(new IncrementalState);
+  const GlobalRoutingSnapshot& snapshot = state->snapshot;
+
+  uint32_t nThreads = GlobalRoutingHelper::GetNThreads();
+  auto startTime = std::chrono::steady_clock::now();
+  std::vector<GlobalRoutingSnapshot::NextHopList> nextHops =
+    snapshot.computeAll(compute, nThreads, isIncremental ? &state->trees : nullptr);
+  std::chrono::duration<double> computeTime = std::chrono::steady_clock::now() - startTime;
+  NS_LOG_INFO("Computed routes of " << snapshot.getNSources() << " nodes in "
+              << computeTime.count() << "s using " << nThreads << " threads");
+
+  for (size_t i = 0; i < snapshot.getNSources(); ++i) {
+    Ptr<Node> node = snapshot.getSourceNode(i);
+    NS_LOG_DEBUG("Reachability from Node: " << node->GetId() << " (" << Names::FindName(node)
+                                            << ")");
+    FibHelper::AddRoutes(node, snapshot.makeRoutes(nextHops[i]));
+  }
 
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-      continue;
-    }
+  LogInstallStats(statsBefore);
 
-    boost::DistancesMap distances;
-
-    dijkstra_shortest_paths(graph, source,
-                            // predecessor_map (boost::ref(predecessors))
-                            // .
-                            distance_map(boost::ref(distances))
-                              .distance_inf(boost::WeightInf)
-                              .distance_zero(boost::WeightZero)
-                              .distance_compare(boost::WeightCompare())
-                              .distance_combine(boost::WeightCombine()));
-
-    // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
-
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-    for (const auto& dist : distances) {
-      if (dist.first == source)
-        continue;
-      else {
-        // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-        if (std::get<0>(dist.second) == 0) {
-          // cout << " is unreachable" << endl;
-        }
-        else {
-          for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-            NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                         << " with distance " << std::get<1>(dist.second) << " with delay "
-                         << std::get<2>(dist.second));
-
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
-          }
-        }
-      }
-    }
+  if (isIncremental) {
+    g_incrementalState = std::move(state);
+    Simulator::ScheduleDestroy(&ClearIncrementalState);
+  }
+  else {
+    g_incrementalState.reset();
   }
 }
 
+void
+GlobalRoutingHelper::CalculateRoutes()
+{
+  CalculateAndInstallRoutes(&GlobalRoutingSnapshot::computeShortestPaths, m_isIncremental);
+}
+
 void
 GlobalRoutingHelper::CalculateAllPossibleRoutes()
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
+  CalculateAndInstallRoutes(&GlobalRoutingSnapshot::computeAllPaths, m_isIncremental);
+}
 
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
+void
+GlobalRoutingHelper::SetIncrementalUpdates(bool isEnabled)
+{
+  m_isIncremental = isEnabled;
+}
 
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+/**
+ * \brief Next hops of all trees of one source
+ */
+static GlobalRoutingSnapshot::NextHopList
+CollectNextHops(const GlobalRoutingSnapshot::TreeList& trees)
+{
+  GlobalRoutingSnapshot::NextHopList nextHops;
+  for (const auto& tree : trees) {
+    nextHops.insert(nextHops.end(), tree.nextHops.begin(), tree.nextHops.end());
+  }
+  return nextHops;
+}
 
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-      continue;
-    }
+/**
+ * \brief Metric of each (prefix, face) next hop that \p routes leave in the FIB
+ *
+ * As with FibHelper::AddRoutes, a later route to the same next hop overrides the cost.
+ */
+static std::map<std::pair<Name, const Face*>, const FibHelper::Route*>
+IndexRoutes(const std::vector<FibHelper::Route>& routes)
+{
+  std::map<std::pair<Name, const Face*>, const FibHelper::Route*> index;
+  for (const FibHelper::Route& route : routes) {
+    index[std::make_pair(route.prefix, route.face.get())] = &route;
+  }
+  return index;
+}
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+GlobalRoutingHelper::UpdateStats
+GlobalRoutingHelper::UpdateRoutes(shared_ptr<Face> face1, shared_ptr<Face> face2, bool isUp)
+{
+  if (g_incrementalState == nullptr) {
+    return UpdateStats{0, 0, 0, 0, 0, 0.0};
+  }
+
+  auto startTime = std::chrono::steady_clock::now();
+  GlobalRoutingSnapshot& snapshot = g_incrementalState->snapshot;
+  std::vector<GlobalRoutingSnapshot::TreeList>& trees = g_incrementalState->trees;
 
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-                                            << Names::FindName(source->GetObject<Node>()) << ")");
+  UpdateStats stats{0, 0, 0, 0, 0, 0.0};
+  for (const auto& nodeTrees : trees) {
+    stats.nTrees += nodeTrees.size();
+  }
 
-    Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
-    NS_ASSERT(l3 != 0);
+  std::vector<GlobalRoutingSnapshot::NextHopList> oldNextHops(trees.size());
+  for (size_t i = 0; i < trees.size(); ++i) {
+    oldNextHops[i] = CollectNextHops(trees[i]);
+  }
 
-    // remember interface statuses
-    std::list<nfd::FaceId> faceIds;
-    std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-    for (auto& i : l3->getForwarder()->getFaceTable()) {
-      shared_ptr<Face> nfdFace = std::dynamic_pointer_cast<Face>(i);
-      faceIds.push_back(nfdFace->getId());
-      originalMetrics[nfdFace->getId()] = nfdFace->getMetric();
-      nfdFace->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-      // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
+  bool isChanged = false;
+  for (const shared_ptr<Face>& face : {face1, face2}) {
+    if (face != nullptr && snapshot.setFaceUp(face, isUp)) {
+      isChanged = true;
     }
+  }
+  std::vector<size_t> nRecomputed;
+  if (isChanged) {
+    nRecomputed = snapshot.updateTrees(trees, GetNThreads());
+  }
 
-    for (auto& faceId : faceIds) {
-      shared_ptr<Face> k = l3->getForwarder()->getFaceTable().get(faceId);
-      shared_ptr<NetDeviceFace> face = std::dynamic_pointer_cast<NetDeviceFace>(k);
-      if (face == 0) {
-        NS_LOG_DEBUG("Skipping non-netdevice face");
-        continue;
+  for (size_t i = 0; i < nRecomputed.size(); ++i) {
+    if (nRecomputed[i] == 0) {
+      continue;
+    }
+    stats.nRecomputedTrees += nRecomputed[i];
+
+    Ptr<Node> node = snapshot.getSourceNode(i);
+    std::vector<FibHelper::Route> oldRoutes = snapshot.makeRoutes(oldNextHops[i]);
+    std::vector<FibHelper::Route> newRoutes = snapshot.makeRoutes(CollectNextHops(trees[i]));
+    auto oldIndex = IndexRoutes(oldRoutes);
+    auto newIndex = IndexRoutes(newRoutes);
+
+    std::vector<FibHelper::Route> addedRoutes;
+    for (const auto& entry : newIndex) {
+      auto old = oldIndex.find(entry.first);
+      if (old == oldIndex.end() || old->second->metric != entry.second->metric) {
+        addedRoutes.push_back(*entry.second);
       }
+    }
 
-      // enabling only faceId
-      face->setMetric(originalMetrics[faceId]);
-
-      boost::DistancesMap distances;
-
-      NS_LOG_DEBUG("-----------");
-
-      dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                              distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
-
-      // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
-
-      for (const auto& dist : distances) {
-        if (dist.first == source)
-          continue;
-        else {
-          // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-          if (std::get<0>(dist.second) == 0) {
-            // cout << " is unreachable" << endl;
-          }
-          else {
-            for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-              NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face "
-                           << *std::get<0>(dist.second)
-                           << " with distance " << std::get<1>(dist.second)
-                           << " with delay " << std::get<2>(dist.second));
-
-              if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                continue;
-
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
-            }
-          }
-        }
+    uint32_t nRemovedRoutes = 0;
+    for (const auto& entry : oldIndex) {
+      if (newIndex.find(entry.first) == newIndex.end()) {
+        FibHelper::RemoveRoute(node, entry.second->prefix, entry.second->face);
+        ++nRemovedRoutes;
       }
-
-      // disabling the face again
-      face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
     }
+    FibHelper::AddRoutes(node, addedRoutes);
 
-    // recover original interface statuses
-    for (auto& i : originalMetrics) {
-      l3->getForwarder()->getFaceTable().get(i.first)->setMetric(i.second);
+    if (nRemovedRoutes > 0 || !addedRoutes.empty()) {
+      ++stats.nUpdatedNodes;
     }
+    stats.nAddedRoutes += addedRoutes.size();
+    stats.nRemovedRoutes += nRemovedRoutes;
   }
+
+  std::chrono::duration<double> updateTime = std::chrono::steady_clock::now() - startTime;
+  stats.seconds = updateTime.count();
+  NS_LOG_INFO("Link " << (isUp ? "up" : "down") << ": recomputed " << stats.nRecomputedTrees
+              << " of " << stats.nTrees << " trees, updated " << stats.nUpdatedNodes
+              << " nodes (+" << stats.nAddedRoutes << " -" << stats.nRemovedRoutes
+              << " next hops) in " << stats.seconds << "s");
+
+  m_lastUpdateStats = stats;
+  return stats;
+}
+
+const GlobalRoutingHelper::UpdateStats&
+GlobalRoutingHelper::GetLastUpdateStats()
+{
+  return m_lastUpdateStats;
 }
 
 } // namespace ndn
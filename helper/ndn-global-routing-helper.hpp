@@ -21,6 +21,7 @@
 #define NDN_GLOBAL_ROUTING_HELPER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
 
 #include "ns3/ptr.h"
 
@@ -38,6 +39,19 @@ namespace ndn {
  */
 class GlobalRoutingHelper {
 public:
+  /**
+   * @brief Cost of one UpdateRoutes call
+   */
+  struct UpdateStats
+  {
+    uint32_t nRecomputedTrees; ///< @brief shortest-path trees recomputed
+    uint32_t nTrees;           ///< @brief shortest-path trees kept for all nodes
+    uint32_t nUpdatedNodes;    ///< @brief nodes whose FIB changed
+    uint32_t nAddedRoutes;     ///< @brief next hops added or whose cost changed
+    uint32_t nRemovedRoutes;   ///< @brief next hops removed
+    double seconds;            ///< @brief wall-clock time of recomputation and FIB updates
+  };
+
   /**
    * @brief Install GlobalRouter interface on a node
    *
@@ -96,6 +110,10 @@ public:
 
   /**
    * @brief Calculate for every node shortest path trees and install routes to all prefix origins
+   *
+   * Shortest paths of different nodes are calculated in parallel (see SetNThreads) on a snapshot
+   * of the topology, then routes are installed node by node.  Installed routes do not depend on
+   * the number of threads.
    */
   static void
   CalculateRoutes();
@@ -111,9 +129,62 @@ public:
   static void
   CalculateAllPossibleRoutes();
 
+  /**
+   * @brief Set the number of threads used by CalculateRoutes and CalculateAllPossibleRoutes
+   * @param nThreads number of threads, 0 (default) for one per hardware thread
+   */
+  static void
+  SetNThreads(uint32_t nThreads);
+
+  /**
+   * @brief Get the number of threads used to calculate routes
+   */
+  static uint32_t
+  GetNThreads();
+
+  /**
+   * @brief Keep the shortest-path trees of the next CalculateRoutes or CalculateAllPossibleRoutes
+   *        so that UpdateRoutes can update routes when links fail or recover
+   *
+   * A tree keeps a 16-bit metric and a 32-bit predecessor of every vertex, i.e., about
+   * 6 * N * N bytes for N nodes with CalculateRoutes, and one tree per face with
+   * CalculateAllPossibleRoutes.  They are released by Simulator::Destroy.
+   */
+  static void
+  SetIncrementalUpdates(bool isEnabled);
+
+  /**
+   * @brief Update routes after the link between @p face1 and @p face2 went down or up
+   *
+   * Only the shortest-path trees that the link can change are recomputed, and only the
+   * difference is applied to FIBs: removed next hops with FibHelper::RemoveRoute, others with
+   * FibHelper::AddRoutes.  New routes follow shortest paths, but equal-cost ties may be broken
+   * differently than by CalculateRoutes.
+   *
+   * Called by LinkControlHelper::FailLink and LinkControlHelper::UpLink.  Does nothing unless
+   * SetIncrementalUpdates was enabled before routes were calculated.
+   *
+   * @param face1 face on one end of the link, may be null
+   * @param face2 face on the other end of the link, may be null
+   * @param isUp  whether the link is now up
+   */
+  static UpdateStats
+  UpdateRoutes(shared_ptr<Face> face1, shared_ptr<Face> face2, bool isUp);
+
+  /**
+   * @brief Cost of the last UpdateRoutes call
+   */
+  static const UpdateStats&
+  GetLastUpdateStats();
+
 private:
   void
   Install(Ptr<Channel> channel);
+
+private:
+  static uint32_t m_nThreads;
+  static bool m_isIncremental;
+  static UpdateStats m_lastUpdateStats;
 };
 
 } // namespace ndn
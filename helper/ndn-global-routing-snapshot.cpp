@@ -0,0 +1,424 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-global-routing-snapshot.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-net-device-face.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+
+#include "ns3/node-list.h"
+#include "ns3/channel-list.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingSnapshot");
+
+namespace ns3 {
+namespace ndn {
+
+const uint32_t GlobalRoutingSnapshot::NO_FACE = std::numeric_limits<uint32_t>::max();
+
+// value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
+const uint16_t GlobalRoutingSnapshot::DISABLED_METRIC = std::numeric_limits<uint16_t>::max() - 1;
+
+// metric of edges that are down, also the distance of unreachable vertices
+const uint16_t GlobalRoutingSnapshot::INFINITE_METRIC = std::numeric_limits<uint16_t>::max();
+
+/**
+ * \brief Call \p work for each index below \p n, using \p nThreads threads
+ */
+static void
+ParallelFor(size_t n, size_t nThreads, const std::function<void(size_t)>& work)
+{
+  std::atomic<size_t> next(0);
+  auto worker = [&] {
+    for (size_t i = next++; i < n; i = next++) {
+      work(i);
+    }
+  };
+
+  std::vector<boost::thread> threads;
+  for (size_t i = 1; i < std::min(nThreads, n); ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (boost::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+/**
+ * \brief Metric of each edge; faces of the source other than the enabled one are disabled
+ */
+class GlobalRoutingSnapshot::WeightMap
+{
+public:
+  typedef Graph::edge_descriptor key_type;
+  typedef Distance value_type;
+  typedef Distance reference;
+  typedef boost::readable_property_map_tag category;
+
+  WeightMap(const GlobalRoutingSnapshot& snapshot, uint32_t source, uint32_t enabledFace)
+    : m_snapshot(snapshot)
+    , m_source(source)
+    , m_enabledFace(enabledFace)
+  {
+  }
+
+  Distance
+  operator[](const key_type& edge) const
+  {
+    return m_snapshot.getWeight(edge, m_source, m_enabledFace);
+  }
+
+  friend Distance
+  get(const WeightMap& map, const key_type& edge)
+  {
+    return map[edge];
+  }
+
+private:
+  const GlobalRoutingSnapshot& m_snapshot;
+  uint32_t m_source;
+  uint32_t m_enabledFace;
+};
+
+/**
+ * \brief Same ordering as boost::WeightCompare: metric only
+ */
+struct GlobalRoutingSnapshot::DistanceCompare
+{
+  bool
+  operator()(const Distance& a, const Distance& b) const
+  {
+    return a.metric < b.metric;
+  }
+};
+
+/**
+ * \brief Same as boost::WeightCombine: metrics add up, the first face is kept
+ */
+struct GlobalRoutingSnapshot::DistanceCombine
+{
+  Distance
+  operator()(const Distance& a, const Distance& b) const
+  {
+    return Distance{a.face == NO_FACE ? b.face : a.face, a.metric + b.metric};
+  }
+};
+
+GlobalRoutingSnapshot::GlobalRoutingSnapshot()
+{
+  // same vertex order as boost::NdnGlobalRouterGraph
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> gr = (*node)->GetObject<GlobalRouter>();
+    if (gr == 0) {
+      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
+      continue;
+    }
+    m_sources.push_back(m_routers.size());
+    m_sourceNodes.push_back(*node);
+    m_routers.push_back(gr);
+  }
+
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<GlobalRouter> gr = (*channel)->GetObject<GlobalRouter>();
+    if (gr != 0) {
+      m_routers.push_back(gr);
+    }
+  }
+
+  std::unordered_map<const GlobalRouter*, uint32_t> vertexIndexes;
+  for (uint32_t vertex = 0; vertex < m_routers.size(); ++vertex) {
+    vertexIndexes[PeekPointer(m_routers[vertex])] = vertex;
+  }
+
+  // edges are listed by source vertex, each in the order of its incidencies
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  std::vector<EdgeProperty> edgeProperties;
+  for (uint32_t vertex = 0; vertex < m_routers.size(); ++vertex) {
+    for (const GlobalRouter::Incidency& incidency : m_routers[vertex]->GetIncidencies()) {
+      auto target = vertexIndexes.find(PeekPointer(std::get<2>(incidency)));
+      NS_ASSERT(target != vertexIndexes.end());
+      edges.emplace_back(vertex, target->second);
+
+      uint32_t face = getFaceIndex(std::get<1>(incidency));
+      edgeProperties.push_back(EdgeProperty{face, face == NO_FACE ? uint16_t(0)
+                                                                  : m_faceMetrics[face]});
+    }
+
+    if (!m_routers[vertex]->GetLocalPrefixes().empty()) {
+      m_origins.push_back(vertex);
+    }
+  }
+  m_graph = Graph(boost::edges_are_sorted, edges.begin(), edges.end(), edgeProperties.begin(),
+                  m_routers.size());
+
+  std::sort(m_origins.begin(), m_origins.end(), [this] (uint32_t a, uint32_t b) {
+      return PeekPointer(m_routers[a]) < PeekPointer(m_routers[b]);
+    });
+
+  for (const Ptr<Node>& node : m_sourceNodes) {
+    Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+    NS_ASSERT(l3 != 0);
+
+    std::vector<uint32_t> faces;
+    for (const auto& face : l3->getForwarder()->getFaceTable()) {
+      auto index = m_faceIndexes.find(face.get());
+      if (index != m_faceIndexes.end() &&
+          std::dynamic_pointer_cast<NetDeviceFace>(face) != nullptr) {
+        faces.push_back(index->second);
+      }
+    }
+    m_sourceFaces.push_back(std::move(faces));
+  }
+}
+
+GlobalRoutingSnapshot::Distance
+GlobalRoutingSnapshot::getWeight(const Graph::edge_descriptor& edge, uint32_t source,
+                                 uint32_t enabledFace) const
+{
+  const EdgeProperty& property = m_graph[edge];
+  if (enabledFace != NO_FACE && property.metric != INFINITE_METRIC &&
+      property.face != enabledFace && property.face != NO_FACE &&
+      boost::source(edge, m_graph) == source) {
+    return Distance{property.face, DISABLED_METRIC};
+  }
+  return Distance{property.face, property.metric};
+}
+
+uint32_t
+GlobalRoutingSnapshot::getFaceIndex(const shared_ptr<Face>& face)
+{
+  if (face == nullptr) {
+    return NO_FACE;
+  }
+
+  auto index = m_faceIndexes.find(face.get());
+  if (index != m_faceIndexes.end()) {
+    return index->second;
+  }
+
+  uint32_t newIndex = m_faces.size();
+  m_faces.push_back(face);
+  m_faceMetrics.push_back(static_cast<uint16_t>(face->getMetric()));
+  m_faceIndexes[face.get()] = newIndex;
+  return newIndex;
+}
+
+void
+GlobalRoutingSnapshot::computeDistances(uint32_t source, uint32_t enabledFace,
+                                        std::vector<Distance>& distances,
+                                        std::vector<uint32_t>& predecessors) const
+{
+  distances.resize(boost::num_vertices(m_graph));
+  predecessors.resize(boost::num_vertices(m_graph));
+
+  auto vertexIndex = boost::get(boost::vertex_index, m_graph);
+  boost::dijkstra_shortest_paths(m_graph, source,
+                                 boost::weight_map(WeightMap(*this, source, enabledFace))
+                                   .predecessor_map(boost::make_iterator_property_map(
+                                                      predecessors.begin(), vertexIndex))
+                                   .distance_map(boost::make_iterator_property_map(
+                                                   distances.begin(), vertexIndex))
+                                   .distance_inf(Distance{NO_FACE, INFINITE_METRIC})
+                                   .distance_zero(Distance{NO_FACE, 0})
+                                   .distance_compare(DistanceCompare())
+                                   .distance_combine(DistanceCombine()));
+}
+
+GlobalRoutingSnapshot::ShortestPathTree
+GlobalRoutingSnapshot::computeTree(size_t sourceIndex, uint32_t enabledFace) const
+{
+  uint32_t source = m_sources[sourceIndex];
+
+  std::vector<Distance> distances;
+  ShortestPathTree tree;
+  tree.enabledFace = enabledFace;
+  computeDistances(source, enabledFace, distances, tree.predecessors);
+
+  tree.metrics.reserve(distances.size());
+  for (const Distance& distance : distances) {
+    tree.metrics.push_back(std::min<uint32_t>(distance.metric, INFINITE_METRIC));
+  }
+
+  for (uint32_t origin : m_origins) {
+    const Distance& distance = distances[origin];
+    if (origin == source || distance.face == NO_FACE) {
+      continue;
+    }
+    // with an enabled face, paths through the other (disabled) faces are not installed
+    if (enabledFace == NO_FACE || distance.face == enabledFace) {
+      tree.nextHops.push_back(NextHop{origin, distance.face, distance.metric});
+    }
+  }
+  return tree;
+}
+
+GlobalRoutingSnapshot::NextHopList
+GlobalRoutingSnapshot::computeShortestPaths(size_t sourceIndex, TreeList* trees) const
+{
+  ShortestPathTree tree = computeTree(sourceIndex, NO_FACE);
+  NextHopList nextHops = tree.nextHops;
+  if (trees != nullptr) {
+    trees->push_back(std::move(tree));
+  }
+  return nextHops;
+}
+
+GlobalRoutingSnapshot::NextHopList
+GlobalRoutingSnapshot::computeAllPaths(size_t sourceIndex, TreeList* trees) const
+{
+  NextHopList nextHops;
+  for (uint32_t face : m_sourceFaces[sourceIndex]) {
+    // a face whose own metric is DISABLED_METRIC is indistinguishable from a disabled one
+    if (m_faceMetrics[face] == DISABLED_METRIC) {
+      continue;
+    }
+
+    ShortestPathTree tree = computeTree(sourceIndex, face);
+    nextHops.insert(nextHops.end(), tree.nextHops.begin(), tree.nextHops.end());
+    if (trees != nullptr) {
+      trees->push_back(std::move(tree));
+    }
+  }
+  return nextHops;
+}
+
+std::vector<GlobalRoutingSnapshot::NextHopList>
+GlobalRoutingSnapshot::computeAll(ComputeFunction compute, size_t nThreads,
+                                  std::vector<TreeList>* trees) const
+{
+  std::vector<NextHopList> nextHops(m_sources.size());
+  if (trees != nullptr) {
+    trees->assign(m_sources.size(), TreeList());
+  }
+
+  // each source writes only its own slot, so the result does not depend on scheduling
+  ParallelFor(m_sources.size(), nThreads, [&] (size_t i) {
+      nextHops[i] = (this->*compute)(i, trees != nullptr ? &(*trees)[i] : nullptr);
+    });
+  return nextHops;
+}
+
+bool
+GlobalRoutingSnapshot::setFaceUp(const shared_ptr<Face>& face, bool isUp)
+{
+  auto index = m_faceIndexes.find(face.get());
+  if (index == m_faceIndexes.end()) {
+    return false;
+  }
+  uint16_t metric = isUp ? m_faceMetrics[index->second] : INFINITE_METRIC;
+
+  bool isChanged = false;
+  for (auto edge : boost::make_iterator_range(boost::edges(m_graph))) {
+    EdgeProperty& property = m_graph[edge];
+    if (property.face != index->second || property.metric == metric) {
+      continue;
+    }
+    property.metric = metric;
+    m_changedEdges.push_back(EdgeChange{static_cast<uint32_t>(boost::source(edge, m_graph)),
+                                        static_cast<uint32_t>(boost::target(edge, m_graph)),
+                                        isUp});
+    isChanged = true;
+  }
+  return isChanged;
+}
+
+bool
+GlobalRoutingSnapshot::isAffected(const ShortestPathTree& tree, uint32_t source) const
+{
+  for (const EdgeChange& change : m_changedEdges) {
+    if (!change.isUp) {
+      // a tree not using the edge keeps all its paths, none of which can get shorter
+      if (tree.predecessors[change.target] == change.source) {
+        return true;
+      }
+      continue;
+    }
+
+    if (tree.metrics[change.source] == INFINITE_METRIC) {
+      continue;
+    }
+    // the edge shortens a path only if it can be relaxed; parallel edges share source and target
+    Graph::vertex_descriptor vertex = change.source;
+    for (auto edge : boost::make_iterator_range(boost::out_edges(vertex, m_graph))) {
+      if (boost::target(edge, m_graph) != change.target) {
+        continue;
+      }
+      uint32_t metric = tree.metrics[change.source] +
+                        getWeight(edge, source, tree.enabledFace).metric;
+      if (metric < tree.metrics[change.target]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+std::vector<size_t>
+GlobalRoutingSnapshot::updateTrees(std::vector<TreeList>& trees, size_t nThreads)
+{
+  NS_ASSERT(trees.size() == m_sources.size());
+
+  std::vector<size_t> nRecomputed(m_sources.size(), 0);
+  if (!m_changedEdges.empty()) {
+    ParallelFor(m_sources.size(), nThreads, [&] (size_t i) {
+        for (ShortestPathTree& tree : trees[i]) {
+          if (isAffected(tree, m_sources[i])) {
+            tree = computeTree(i, tree.enabledFace);
+            ++nRecomputed[i];
+          }
+        }
+      });
+  }
+  m_changedEdges.clear();
+  return nRecomputed;
+}
+
+std::vector<FibHelper::Route>
+GlobalRoutingSnapshot::makeRoutes(const NextHopList& nextHops) const
+{
+  std::vector<FibHelper::Route> routes;
+  for (const NextHop& nextHop : nextHops) {
+    for (const auto& prefix : m_routers[nextHop.vertex]->GetLocalPrefixes()) {
+      NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *m_faces[nextHop.face]
+                   << " with distance " << nextHop.metric);
+      routes.emplace_back(*prefix, m_faces[nextHop.face], nextHop.metric);
+    }
+  }
+  return routes;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GLOBAL_ROUTING_SNAPSHOT_H
+#define NDN_GLOBAL_ROUTING_SNAPSHOT_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/helper/ndn-fib-helper.hpp"
+
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Immutable copy of the GlobalRouter topology, used by GlobalRoutingHelper to compute
+ *        routes
+ *
+ * The snapshot is taken from NodeList and ChannelList on the simulation thread.  Vertices, faces
+ * and metrics are then plain integers, so shortest paths from different sources can be computed
+ * on several threads at once: ns-3 reference counting is not thread-safe and is only used by
+ * the constructor and makeRoutes.
+ *
+ * The topology is stored as a compressed sparse row graph: the out-edges of all vertices are in
+ * one array, each with its target, face and metric, and Dijkstra keeps distances and predecessors
+ * in vectors indexed by vertex.
+ *
+ * Vertices and their out-edges are kept in the order of boost::NdnGlobalRouterGraph, and Dijkstra
+ * is the same Boost Graph Library algorithm with the same metric comparison, so ties between
+ * equal-cost paths are broken as before and the computed next hops are identical.
+ *
+ * Faces can later be marked down or up again (setFaceUp); updateTrees then recomputes only the
+ * shortest-path trees that the changed edges can affect.
+ */
+class GlobalRoutingSnapshot : noncopyable {
+public:
+  /**
+   * @brief Next hop from a source towards a vertex that originates prefixes
+   */
+  struct NextHop
+  {
+    uint32_t vertex;
+    uint32_t face;
+    uint32_t metric;
+  };
+
+  typedef std::vector<NextHop> NextHopList;
+
+  /**
+   * @brief Result of one Dijkstra run, kept to update routes incrementally
+   */
+  struct ShortestPathTree
+  {
+    /// face of the source the run is restricted to, or NO_FACE
+    uint32_t enabledFace;
+    /// metric of the path to each vertex, std::numeric_limits<uint16_t>::max() if unreachable
+    std::vector<uint16_t> metrics;
+    /// previous vertex on the path to each vertex
+    std::vector<uint32_t> predecessors;
+    /// next hops installed from this run
+    NextHopList nextHops;
+  };
+
+  typedef std::vector<ShortestPathTree> TreeList;
+
+  typedef NextHopList (GlobalRoutingSnapshot::*ComputeFunction)(size_t sourceIndex,
+                                                                 TreeList* trees) const;
+
+  GlobalRoutingSnapshot();
+
+  /**
+   * @brief Number of nodes with GlobalRouter, which are the sources of route computation
+   */
+  size_t
+  getNSources() const;
+
+  /**
+   * @brief Node of source @p sourceIndex, sources are in NodeList order
+   */
+  Ptr<Node>
+  getSourceNode(size_t sourceIndex) const;
+
+  /**
+   * @brief Next hops along the shortest path to every reachable origin, as installed by
+   *        GlobalRoutingHelper::CalculateRoutes
+   * @param[out] trees if not null, the shortest-path tree is appended to it
+   */
+  NextHopList
+  computeShortestPaths(size_t sourceIndex, TreeList* trees = nullptr) const;
+
+  /**
+   * @brief Next hops along the shortest path through each face of the source, as installed by
+   *        GlobalRoutingHelper::CalculateAllPossibleRoutes
+   * @param[out] trees if not null, the shortest-path tree of each face is appended to it
+   */
+  NextHopList
+  computeAllPaths(size_t sourceIndex, TreeList* trees = nullptr) const;
+
+  /**
+   * @brief Apply @p compute to every source, using @p nThreads threads
+   * @param[out] trees if not null, set to the shortest-path trees of each source
+   * @return next hops of each source, in source order regardless of @p nThreads
+   */
+  std::vector<NextHopList>
+  computeAll(ComputeFunction compute, size_t nThreads,
+             std::vector<TreeList>* trees = nullptr) const;
+
+  /**
+   * @brief Mark all edges through @p face as down (infinite metric) or up (metric of the face)
+   *
+   * Changed edges are remembered until the next updateTrees.
+   *
+   * @return false if @p face does not link two routers or is already in the requested state
+   */
+  bool
+  setFaceUp(const shared_ptr<Face>& face, bool isUp);
+
+  /**
+   * @brief Recompute, using @p nThreads threads, the trees that edges changed by setFaceUp since
+   *        the last call can affect
+   *
+   * A tree is recomputed when a removed edge is on it or an added edge shortens a path in it.
+   * Other trees remain shortest-path trees, but ties between equal-cost paths may be broken
+   * differently than by a computation from scratch.
+   *
+   * @param trees trees of each source, as returned by computeAll
+   * @return number of recomputed trees of each source
+   */
+  std::vector<size_t>
+  updateTrees(std::vector<TreeList>& trees, size_t nThreads);
+
+  /**
+   * @brief Convert @p nextHops to FIB routes, one per local prefix of each origin
+   *
+   * Must be called on the simulation thread.
+   */
+  std::vector<FibHelper::Route>
+  makeRoutes(const NextHopList& nextHops) const;
+
+private:
+  /**
+   * @brief Distance of a vertex from the source, and the first face on the way
+   *
+   * Also used as the weight of edges, whose face is that of the edge.
+   */
+  struct Distance
+  {
+    uint32_t face;
+    uint32_t metric;
+  };
+
+  struct EdgeProperty
+  {
+    uint32_t face;
+    uint16_t metric;
+  };
+
+  /**
+   * @brief Edge whose metric was changed by setFaceUp
+   */
+  struct EdgeChange
+  {
+    uint32_t source;
+    uint32_t target;
+    bool isUp;
+  };
+
+  typedef boost::compressed_sparse_row_graph<boost::directedS, boost::no_property,
+                                             EdgeProperty> Graph;
+
+  class WeightMap;
+  struct DistanceCompare;
+  struct DistanceCombine;
+
+  /**
+   * @brief Run Dijkstra from @p source
+   * @param enabledFace if not NO_FACE, all other faces of @p source are disabled by giving them
+   *                    DISABLED_METRIC, as CalculateAllPossibleRoutes did
+   * @param[out] distances distance of each vertex
+   * @param[out] predecessors previous vertex on the path to each vertex, the vertex itself if
+   *                          it is the source or unreachable
+   */
+  void
+  computeDistances(uint32_t source, uint32_t enabledFace, std::vector<Distance>& distances,
+                   std::vector<uint32_t>& predecessors) const;
+
+  /**
+   * @brief Run Dijkstra from source @p sourceIndex and select the next hops it installs
+   */
+  ShortestPathTree
+  computeTree(size_t sourceIndex, uint32_t enabledFace) const;
+
+  /**
+   * @brief Weight of @p edge in the Dijkstra run from @p source restricted to @p enabledFace
+   */
+  Distance
+  getWeight(const Graph::edge_descriptor& edge, uint32_t source, uint32_t enabledFace) const;
+
+  /**
+   * @brief Whether the edges in m_changedEdges can change @p tree of @p source
+   */
+  bool
+  isAffected(const ShortestPathTree& tree, uint32_t source) const;
+
+  uint32_t
+  getFaceIndex(const shared_ptr<Face>& face);
+
+private:
+  static const uint32_t NO_FACE;
+  static const uint16_t DISABLED_METRIC;
+  static const uint16_t INFINITE_METRIC;
+
+  Graph m_graph;
+  std::vector<Ptr<GlobalRouter>> m_routers;
+
+  std::vector<shared_ptr<Face>> m_faces;
+  std::vector<uint16_t> m_faceMetrics;
+  std::unordered_map<const Face*, uint32_t> m_faceIndexes;
+
+  /// vertices with local prefixes, ordered by GlobalRouter pointer like boost::DistancesMap
+  std::vector<uint32_t> m_origins;
+
+  std::vector<uint32_t> m_sources;
+  std::vector<Ptr<Node>> m_sourceNodes;
+  /// NetDeviceFaces of each source linked to another router, in FaceTable order
+  std::vector<std::vector<uint32_t>> m_sourceFaces;
+
+  std::vector<EdgeChange> m_changedEdges;
+};
+
+inline size_t
+GlobalRoutingSnapshot::getNSources() const
+{
+  return m_sources.size();
+}
+
+inline Ptr<Node>
+GlobalRoutingSnapshot::getSourceNode(size_t sourceIndex) const
+{
+  return m_sourceNodes.at(sourceIndex);
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GLOBAL_ROUTING_SNAPSHOT_H
@@ -18,6 +18,7 @@
  **/
 
 #include "ndn-link-control-helper.hpp"
+#include "ndn-global-routing-helper.hpp"
 
 #include "ns3/assert.h"
 #include "ns3/names.h"
@@ -41,7 +42,7 @@ NS_LOG_COMPONENT_DEFINE("ndn.LinkControlHelper");
 namespace ns3 {
 namespace ndn {
 
-void
+std::pair<shared_ptr<Face>, shared_ptr<Face>>
 LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate)
 {
   NS_LOG_FUNCTION(node1 << node2 << errorRate);
@@ -84,16 +85,18 @@ LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRa
 
       nd1->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
       nd2->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
-      return;
+      return std::make_pair(face, ndn2->getFaceByNetDevice(nd2));
     }
   }
   NS_FATAL_ERROR("There is no link to fail between the requested nodes");
+  return {};
 }
 
 void
 LinkControlHelper::FailLink(Ptr<Node> node1, Ptr<Node> node2)
 {
-  setErrorRate(node1, node2, 1.0);
+  auto faces = setErrorRate(node1, node2, 1.0);
+  GlobalRoutingHelper::UpdateRoutes(faces.first, faces.second, false);
 }
 
 void
@@ -105,7 +108,8 @@ LinkControlHelper::FailLinkByName(const std::string& node1, const std::string& n
 void
 LinkControlHelper::UpLink(Ptr<Node> node1, Ptr<Node> node2)
 {
-  setErrorRate(node1, node2, -0.1); // this will ensure error model is disabled
+  auto faces = setErrorRate(node1, node2, -0.1); // this will ensure error model is disabled
+  GlobalRoutingHelper::UpdateRoutes(faces.first, faces.second, true);
 }
 
 void
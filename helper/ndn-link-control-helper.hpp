@@ -21,6 +21,7 @@
 #define NDN_LINK_CONTROL_HELPER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/node.h"
@@ -41,6 +42,9 @@ public:
    * The helper will attempt to find NDN link between node1 and
    * node2 and set NDN face to DOWN state
    *
+   * If GlobalRoutingHelper::SetIncrementalUpdates was enabled, routes are updated by
+   * GlobalRoutingHelper::UpdateRoutes
+   *
    * Note that only PointToPointChannels are supported by this helper method
    *
    * @param node1 one node
@@ -71,6 +75,9 @@ public:
    * The helper will attempt to find NDN link between node1 and
    * node2 and set NDN face to UP state
    *
+   * If GlobalRoutingHelper::SetIncrementalUpdates was enabled, routes are updated by
+   * GlobalRoutingHelper::UpdateRoutes
+   *
    * Note that only PointToPointChannels are supported by this helper method
    *
    * @param node1 one node
@@ -96,7 +103,10 @@ public:
   UpLinkByName(const std::string& node1, const std::string& node2);
 
 private:
-  static void
+  /**
+   * @return faces of node1 and node2 on the link
+   */
+  static std::pair<shared_ptr<Face>, shared_ptr<Face>>
   setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate);
 }; // LinkControlHelper
 
@@ -32,6 +32,7 @@
 #include "ns3/string.h"
 
 #include "../../utils/trie/trie-with-policy.hpp"
+#include "../../utils/trie/radix-trie.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -85,12 +86,12 @@ class ContentStoreImpl
       trie_with_policy<Name,
                        ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                             Entry>,
-                       Policy> {
+                       Policy, ndnSIM::radix_trie> {
 public:
   typedef ndnSIM::
     trie_with_policy<Name, ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                                 Entry>,
-                     Policy> super;
+                     Policy, ndnSIM::radix_trie> super;
 
   typedef EntryImpl<ContentStoreImpl<Policy>> entry;
 
@@ -102,7 +103,7 @@ public:
 
   // from ContentStore
 
-  virtual inline shared_ptr<Data>
+  virtual inline shared_ptr<const Data>
   Lookup(shared_ptr<const Interest> interest);
 
   virtual inline bool
@@ -202,7 +203,7 @@ private:
 };
 
 template<class Policy>
-shared_ptr<Data>
+shared_ptr<const Data>
 ContentStoreImpl<Policy>::Lookup(shared_ptr<const Interest> interest)
 {
   NS_LOG_FUNCTION(this << interest->getName());
@@ -217,10 +218,9 @@ ContentStoreImpl<Policy>::Lookup(shared_ptr<const Interest> interest)
   }
 
   if (node != this->end()) {
-    this->m_cacheHitsTrace(interest, node->payload()->GetData());
-
-    shared_ptr<Data> copy = make_shared<Data>(*node->payload()->GetData());
-    return copy;
+    shared_ptr<const Data> data = node->payload()->GetData();
+    this->m_cacheHitsTrace(interest, data);
+    return data;
   }
   else {
     this->m_cacheMissesTrace(interest);
@@ -105,7 +105,7 @@ struct freshness_policy_traits {
       inline bool
       insert(typename parent_trie::iterator item)
       {
-        time::milliseconds freshness = item->payload()->GetData()->getFreshnessPeriod();
+        time::milliseconds freshness = item->payload()->GetFreshnessPeriod();
         if (freshness > time::milliseconds::zero()) {
           get_freshness(item) = Simulator::Now() + MilliSeconds(freshness.count());
 
@@ -128,7 +128,7 @@ struct freshness_policy_traits {
       inline void
       erase(typename parent_trie::iterator item)
       {
-        time::milliseconds freshness = item->payload()->GetData()->getFreshnessPeriod();
+        time::milliseconds freshness = item->payload()->GetFreshnessPeriod();
         if (freshness > time::milliseconds::zero()) {
           // erase only if freshness is positive (otherwise an item is not in the policy)
           policy_container::erase(policy_container::s_iterator_to(*item));
@@ -58,22 +58,35 @@ namespace cs {
 
 Entry::Entry(Ptr<ContentStore> cs, shared_ptr<const Data> data)
   : m_cs(cs)
-  , m_data(data)
+  , m_name(data->getName())
+  , m_freshnessPeriod(data->getFreshnessPeriod())
 {
+  const Block& wire = data->wireEncode();
+  m_wire = Block(wire.getBuffer(), wire.type(), wire.begin(), wire.end(),
+                 wire.value_begin(), wire.value_end());
 }
 
 const Name&
 Entry::GetName() const
 {
-  return m_data->getName();
+  return m_name;
 }
 
 shared_ptr<const Data>
 Entry::GetData() const
 {
+  if (m_data == nullptr) {
+    m_data = make_shared<Data>(m_wire);
+  }
   return m_data;
 }
 
+const time::milliseconds&
+Entry::GetFreshnessPeriod() const
+{
+  return m_freshnessPeriod;
+}
+
 Ptr<ContentStore>
 Entry::GetContentStore()
 {
@@ -50,6 +50,10 @@ namespace cs {
 /**
  * @ingroup ndn-cs
  * @brief NDN content store entry
+ *
+ * The entry keeps the wire encoding of the Data, its Name and its FreshnessPeriod. The Data
+ * packet is decoded on the first cache hit and then kept, so that later hits return the same
+ * immutable Data. Entries that are never hit hold only the wire encoding.
  */
 class Entry : public SimpleRefCount<Entry> {
 public:
@@ -73,11 +77,19 @@ public:
 
   /**
    * \brief Get Data of the stored entry
-   * \returns Data of the stored entry
+   * \returns Data of the stored entry, decoded from the stored wire encoding on the first call
+   *
+   * The returned Data is shared by all hits on the entry and must not be modified.
    */
   shared_ptr<const Data>
   GetData() const;
 
+  /**
+   * \brief Get FreshnessPeriod of the stored entry
+   */
+  const time::milliseconds&
+  GetFreshnessPeriod() const;
+
   /**
    * @brief Get pointer to access store, to which this entry is added
    */
@@ -85,8 +97,11 @@ public:
   GetContentStore();
 
 private:
-  Ptr<ContentStore> m_cs;        ///< \brief content store to which entry is added
-  shared_ptr<const Data> m_data; ///< \brief non-modifiable Data
+  Ptr<ContentStore> m_cs;                ///< \brief content store to which entry is added
+  Block m_wire;                          ///< \brief wire encoding of Data, not parsed
+  mutable shared_ptr<const Data> m_data; ///< \brief Data decoded on the first hit, if any
+  Name m_name;                           ///< \brief Name of Data
+  time::milliseconds m_freshnessPeriod;  ///< \brief FreshnessPeriod of Data
 };
 
 } // namespace cs
@@ -119,8 +134,10 @@ public:
    *
    * If an entry is found, it is promoted to the top of most recent
    * used entries index, \see m_contentStore
+   *
+   * \returns the cached Data, shared with the entry, or nullptr on a miss
    */
-  virtual shared_ptr<Data>
+  virtual shared_ptr<const Data>
   Lookup(shared_ptr<const Interest> interest) = 0;
 
   /**
@@ -19,12 +19,6 @@
 
 #include "ndn-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
-
-namespace io = boost::iostreams;
-
 namespace ns3 {
 namespace ndn {
 
@@ -87,41 +81,65 @@ PacketHeader<Pkt>::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_packet->wireEncode().wire(), m_packet->wireEncode().size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
+/**
+ * @brief Make sure that at least @p size octets remain to be read from @p is
+ */
+static void
+checkRemainingSize(const ns3::Buffer::Iterator& is, uint32_t size)
+{
+  if (is.GetRemainingSize() < size) {
+    throw ::ndn::tlv::Error("Insufficient data during TLV processing");
   }
+}
 
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
-  }
+/**
+ * @brief Read TLV VAR-NUMBER directly from ns3::Buffer::Iterator
+ */
+static uint64_t
+readVarNumber(ns3::Buffer::Iterator& is)
+{
+  checkRemainingSize(is, 1);
 
-private:
-  ns3::Buffer::Iterator& m_is;
-};
+  uint8_t firstOctet = is.ReadU8();
+  if (firstOctet < 253) {
+    return firstOctet;
+  }
+  else if (firstOctet == 253) {
+    checkRemainingSize(is, 2);
+    return is.ReadNtohU16();
+  }
+  else if (firstOctet == 254) {
+    checkRemainingSize(is, 4);
+    return is.ReadNtohU32();
+  }
+  else {
+    checkRemainingSize(is, 8);
+    return is.ReadNtohU64();
+  }
+}
 
 template<class Pkt>
 uint32_t
 PacketHeader<Pkt>::Deserialize(ns3::Buffer::Iterator start)
 {
+  // Peek TLV-TYPE and TLV-LENGTH to learn the size of the whole block, then copy the block in
+  // one go into a contiguous buffer that is used directly as the underlying Block storage
+  ns3::Buffer::Iterator begin = start;
+  readVarNumber(start); // TLV-TYPE
+  uint64_t length = readVarNumber(start);
+  uint32_t headerSize = start.GetDistanceFrom(begin);
+
+  if (length > start.GetRemainingSize()) {
+    throw ::ndn::tlv::Error("Not enough data in the buffer to fully parse TLV");
+  }
+
+  auto buffer = make_shared<::ndn::Buffer>(headerSize + length);
+  begin.Read(buffer->buf(), buffer->size());
+
   auto packet = make_shared<Pkt>();
-  io::stream<Ns3BufferIteratorSource> is(start);
-  packet->wireDecode(::ndn::Block::fromStream(is));
+  packet->wireDecode(::ndn::Block(buffer));
   m_packet = packet;
-  return packet->wireEncode().size();
+  return buffer->size();
 }
 
 template<>
@@ -31,6 +31,7 @@
 // #include "ns3/address.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
+#include "../../internet/model/codel-queue2.h"
 
 #include "../utils/ndn-fw-hop-count-tag.hpp"
 
@@ -39,6 +40,9 @@ NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceFace");
 namespace ns3 {
 namespace ndn {
 
+const double NetDeviceFace::HIGH_CONGESTION_QUEUE_PERC = 0.9;
+const double NetDeviceFace::HIGH_CONGESTION_DELAY_MS = 1000;
+
 NetDeviceFace::NetDeviceFace(Ptr<Node> node, const Ptr<NetDevice>& netDevice)
   : Face(FaceUri("netDeviceFace://"), FaceUri("netDeviceFace://"))
   , m_node(node)
@@ -53,6 +57,8 @@ NetDeviceFace::NetDeviceFace(Ptr<Node> node, const Ptr<NetDevice>& netDevice)
   m_node->RegisterProtocolHandler(MakeCallback(&NetDeviceFace::receiveFromNetDevice, this),
                                   L3Protocol::ETHERNET_FRAME_TYPE, m_netDevice,
                                   true /*promiscuous mode*/);
+
+  m_p2pNetDevice = DynamicCast<PointToPointNetDevice>(m_netDevice);
 }
 
 NetDeviceFace::~NetDeviceFace()
@@ -74,6 +80,41 @@ NetDeviceFace::GetNetDevice() const
   return m_netDevice;
 }
 
+CoDelQueue2*
+NetDeviceFace::getCodelQueue() const
+{
+  if (m_p2pNetDevice == nullptr) {
+    return nullptr;
+  }
+
+  Ptr<Queue> queue = m_p2pNetDevice->GetQueue();
+  if (queue != m_queue) {
+    m_queue = queue;
+    m_codelQueue = DynamicCast<CoDelQueue2>(queue);
+  }
+  return PeekPointer(m_codelQueue);
+}
+
+bool
+NetDeviceFace::isCongested() const
+{
+  CoDelQueue2* codelQueue = getCodelQueue();
+  return codelQueue != nullptr && codelQueue->isOkToMark();
+}
+
+bool
+NetDeviceFace::isHighlyCongested() const
+{
+  CoDelQueue2* codelQueue = getCodelQueue();
+  if (codelQueue == nullptr) {
+    return false;
+  }
+
+  double timeOverMS = static_cast<double>(codelQueue->getTimeOverLimitInNS()) / (1000 * 1000);
+  return timeOverMS > HIGH_CONGESTION_DELAY_MS
+    || codelQueue->isQueueOverLimit(HIGH_CONGESTION_QUEUE_PERC);
+}
+
 void
 NetDeviceFace::send(Ptr<Packet> packet)
 {
@@ -111,6 +152,17 @@ NetDeviceFace::sendData(const Data& data)
   send(packet);
 }
 
+void
+NetDeviceFace::sendCachedData(const Data& data, const nfd::CsHit& hit)
+{
+  NS_LOG_FUNCTION(this << &data);
+
+  this->emitSignal(onSendData, data);
+
+  Ptr<Packet> packet = Convert::ToPacket(data, hit.congestionTag);
+  send(packet);
+}
+
 // callback
 void
 NetDeviceFace::receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol,
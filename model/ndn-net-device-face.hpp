@@ -26,6 +26,11 @@
 #include "ns3/net-device.h"
 
 namespace ns3 {
+
+class Queue;
+class CoDelQueue2;
+class PointToPointNetDevice;
+
 namespace ndn {
 
 /**
@@ -62,9 +67,29 @@ public: // from nfd::Face
   virtual void
   sendData(const Data& data);
 
+  virtual void
+  sendCachedData(const Data& data, const nfd::CsHit& hit);
+
   virtual void
   close();
 
+  /**
+   * \brief Whether the CoDel queue of the NetDevice asks for congestion marking
+   *
+   * Always false if the NetDevice has no CoDelQueue2
+   */
+  virtual bool
+  isCongested() const;
+
+  /**
+   * \brief Whether the CoDel queue of the NetDevice is over HIGH_CONGESTION_QUEUE_PERC of its
+   * limit or its queuing delay has been over target for more than HIGH_CONGESTION_DELAY_MS
+   *
+   * Always false if the NetDevice has no CoDelQueue2
+   */
+  virtual bool
+  isHighlyCongested() const;
+
 public:
   /**
    * \brief Get NetDevice associated with the face
@@ -78,6 +103,15 @@ private:
   void
   send(Ptr<Packet> packet);
 
+  /**
+   * \brief Get the queue of the NetDevice if it is a CoDelQueue2
+   *
+   * The queue can be installed or replaced (e.g., by SimHelper::setNodeQueue) after the face
+   * was created, so it is looked up again whenever the NetDevice has a different queue.
+   */
+  CoDelQueue2*
+  getCodelQueue() const;
+
   /// \brief callback from lower layers
   void
   receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol,
@@ -86,6 +120,12 @@ private:
 private:
   Ptr<Node> m_node;
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
+  Ptr<PointToPointNetDevice> m_p2pNetDevice; ///< \brief m_netDevice, if it is point-to-point
+  mutable Ptr<Queue> m_queue; ///< \brief queue m_codelQueue was resolved from
+  mutable Ptr<CoDelQueue2> m_codelQueue; ///< \brief m_queue, if it is a CoDelQueue2
+
+  static const double HIGH_CONGESTION_QUEUE_PERC;
+  static const double HIGH_CONGESTION_DELAY_MS;
 };
 
 } // namespace ndn
@@ -27,17 +27,38 @@
 #include "../utils/ndn-ns3-cc-tag.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
+#include <type_traits>
+
 namespace ns3 {
 namespace ndn {
 
+bool Convert::s_wirePacketReuse = true;
+
+void Convert::setWirePacketReuse(bool enable)
+{
+  s_wirePacketReuse = enable;
+}
+
 template<class T>
 std::shared_ptr<const T> Convert::FromPacket(Ptr<Packet> packet)
 {
+  // Interest nonce can be rewritten in place inside the wire buffer (Interest::setNonce), so only
+  // Data packets can safely be forwarded using the originally received packet
+  Ptr<const Packet> wirePacket;
+  if (s_wirePacketReuse && std::is_same<T, Data>::value) {
+    wirePacket = packet->Copy();
+  }
+
   PacketHeader<T> header;
   packet->RemoveHeader(header);
 
   auto pkt = header.getPacket();
-  pkt->setTag(make_shared < Ns3PacketTag > (packet));
+  if (wirePacket != nullptr) {
+    pkt->setTag(make_shared<Ns3PacketTag>(packet, wirePacket, pkt->wireEncode()));
+  }
+  else {
+    pkt->setTag(make_shared<Ns3PacketTag>(packet));
+  }
 
   return pkt;
 }
@@ -49,21 +70,35 @@ template std::shared_ptr<const Data>
 Convert::FromPacket<Data>(Ptr<Packet> packet);
 
 template<class T>
-Ptr<Packet> Convert::ToPacket(const T& pkt)
+Ptr<Packet> Convert::ToPacket(const T& pkt, std::shared_ptr<::ndn::CongestionTag> congestionTag)
 {
-  PacketHeader<T> header(pkt);
-
   Ptr<Packet> packet;
+  bool needHeader = true;
 
   auto tag = pkt.template getTag<Ns3PacketTag>();
   if (tag != nullptr) {
-    packet = tag->getPacket()->Copy();
+    Ptr<const Packet> wirePacket;
+    if (s_wirePacketReuse && pkt.hasWire()) {
+      wirePacket = tag->getWirePacket(pkt.wireEncode());
+    }
+
+    if (wirePacket != nullptr) {
+      // unmodified since received: header bytes are already in place
+      packet = wirePacket->Copy();
+      needHeader = false;
+    }
+    else {
+      packet = tag->getPacket()->Copy();
+    }
   }
   else {
     packet = Create<Packet>();
   }
 
-  shared_ptr<::ndn::CongestionTag> tag2 = pkt.template getTag<::ndn::CongestionTag>();
+  shared_ptr<::ndn::CongestionTag> tag2 = congestionTag;
+  if (tag2 == nullptr) {
+    tag2 = pkt.template getTag<::ndn::CongestionTag>();
+  }
 
   if (tag2 != nullptr) {
     Ns3CCTag ns3cctag = Ns3CCTag(tag2->getNackType(), tag2->getCongMark(), tag2->getHighCongMark(),
@@ -76,15 +111,18 @@ Ptr<Packet> Convert::ToPacket(const T& pkt)
     packet->ReplacePacketTag(ns3cctag);
   }
 
-  packet->AddHeader(header);
+  if (needHeader) {
+    packet->AddHeader(PacketHeader<T>(pkt));
+  }
   return packet;
 }
 
 template Ptr<Packet>
-Convert::ToPacket<Interest>(const Interest& packet);
+Convert::ToPacket<Interest>(const Interest& packet,
+                            std::shared_ptr<::ndn::CongestionTag> congestionTag);
 
 template Ptr<Packet>
-Convert::ToPacket<Data>(const Data& packet);
+Convert::ToPacket<Data>(const Data& packet, std::shared_ptr<::ndn::CongestionTag> congestionTag);
 
 uint32_t Convert::getPacketType(Ptr<const Packet> packet)
 {
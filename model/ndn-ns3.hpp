@@ -24,6 +24,10 @@
 #include "ns3/ptr.h"
 #include <memory>
 
+namespace ndn {
+class CongestionTag;
+} // namespace ndn
+
 namespace ns3 {
 namespace ndn {
 
@@ -33,12 +37,31 @@ public:
   static std::shared_ptr<const T>
   FromPacket(Ptr<Packet> packet);
 
+  /**
+   * @brief Convert an NDN packet to an ns-3 packet
+   *
+   * @param congestionTag congestion mark to attach to the ns-3 packet instead of the
+   *        CongestionTag of @p pkt, e.g. the per-hit mark of a Data from the content store
+   */
   template<class T>
   static Ptr<Packet>
-  ToPacket(const T& pkt);
+  ToPacket(const T& pkt, std::shared_ptr<::ndn::CongestionTag> congestionTag = nullptr);
 
   static uint32_t
   getPacketType(Ptr<const Packet> packet);
+
+  /**
+   * @brief Enable or disable reuse of received ns-3 packets when forwarding unmodified Data
+   *
+   * When enabled (default), FromPacket<Data> remembers the received packet and ToPacket<Data>
+   * sends a copy-on-write copy of it if the Data has not been re-encoded in between, so that
+   * a forwarded Data is neither re-serialized nor copied into a new packet buffer.
+   */
+  static void
+  setWirePacketReuse(bool enable);
+
+private:
+  static bool s_wirePacketReuse;
 };
 
 } // namespace ndn
@@ -0,0 +1,254 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+
+#include "ns3/core-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "table/cs.hpp"
+
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <sys/time.h>
+#include <algorithm>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Compares the lookup paths of nfd::Cs, the ordered Table alone ("ordered") and the hash
+ * index in front of it ("hash"), for 10^5 to 10^6 cached packets.
+ *
+ * Interests carry no selectors. Hits ask for the exact Name of a cached packet, misses for a
+ * segment of a cached object that is not cached. Every lookup uses a new Interest, so the
+ * hash index also pays for hashing the Interest Name (in the forwarder, Pit::insert has
+ * already done that).
+ *
+ * With --memory, it instead reports the growth of the resident set per cached packet for
+ * --max packets, decoded from their own wire buffers as they are when received from a face.
+ * "legacy" also keeps every decoded Data alive, as cache entries did before they were reduced
+ * to the wire encoding. Run each in its own process, as freed memory is not returned.
+ *
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --max=1000000"
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --max=1000000 --memory=legacy"
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --max=1000000 --memory=current"
+ */
+class CsBenchmark {
+public:
+  CsBenchmark()
+    : m_maxNPackets(1000000)
+    , m_nLookups(1000000)
+    , m_checksum(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  makePackets(size_t nPackets);
+
+  std::vector<std::shared_ptr<ndn::Interest>>
+  makeInterests(const std::vector<ndn::Name>& names) const;
+
+  double
+  runLookups(const nfd::Cs& cs, const std::vector<std::shared_ptr<ndn::Interest>>& interests);
+
+  void
+  runIndex(bool shouldUseHashIndex);
+
+  double
+  runMemory(bool shouldKeepData);
+
+private:
+  uint32_t m_maxNPackets;
+  uint32_t m_nLookups;
+  std::string m_memoryMode;
+  std::vector<std::shared_ptr<ndn::Data>> m_packets;
+  std::vector<ndn::Name> m_hitNames;
+  std::vector<ndn::Name> m_missNames;
+  uint64_t m_checksum; ///< keeps the compiler from dropping the measured loops
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+void
+CsBenchmark::makePackets(size_t nPackets)
+{
+  std::mt19937 rng(nPackets);
+  std::uniform_int_distribution<int> site(0, 99);
+  std::uniform_int_distribution<int> object(0, 9999);
+
+  ::ndn::SignatureSha256WithRsa fakeSignature;
+  fakeSignature.setValue(::ndn::dataBlock(::ndn::tlv::SignatureValue,
+                                          static_cast<const uint8_t*>(nullptr), 0));
+
+  m_packets.clear();
+  std::vector<ndn::Name> missNames;
+  for (size_t i = 0; i < nPackets; ++i) {
+    ndn::Name prefix("/ndn");
+    prefix.append("site" + std::to_string(site(rng)));
+    prefix.append("object" + std::to_string(object(rng)));
+
+    auto data = std::make_shared<ndn::Data>(ndn::Name(prefix).appendSegment(i));
+    data->setFreshnessPeriod(::ndn::time::seconds(1000));
+    data->setSignature(fakeSignature);
+    data->wireEncode();
+    m_packets.push_back(data);
+
+    missNames.push_back(ndn::Name(prefix).appendSegment(nPackets + i));
+  }
+
+  std::uniform_int_distribution<size_t> index(0, nPackets - 1);
+  m_hitNames.resize(m_nLookups);
+  m_missNames.resize(m_nLookups);
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    m_hitNames[i] = m_packets[index(rng)]->getName();
+    m_missNames[i] = missNames[index(rng)];
+  }
+}
+
+std::vector<std::shared_ptr<ndn::Interest>>
+CsBenchmark::makeInterests(const std::vector<ndn::Name>& names) const
+{
+  std::vector<std::shared_ptr<ndn::Interest>> interests;
+  interests.reserve(names.size());
+  for (const ndn::Name& name : names) {
+    interests.push_back(std::make_shared<ndn::Interest>(name));
+  }
+  return interests;
+}
+
+double
+CsBenchmark::runLookups(const nfd::Cs& cs,
+                        const std::vector<std::shared_ptr<ndn::Interest>>& interests)
+{
+  double begin = now();
+  for (const std::shared_ptr<ndn::Interest>& interest : interests) {
+    cs.find(*interest,
+            [this] (const ndn::Interest&, const ndn::Data& data) {
+              m_checksum += data.getName().size();
+            },
+            [this] (const ndn::Interest&) {
+              ++m_checksum;
+            });
+  }
+  return now() - begin;
+}
+
+void
+CsBenchmark::runIndex(bool shouldUseHashIndex)
+{
+  nfd::Cs cs(m_packets.size(), nfd::cs::makeDefaultPolicy(), shouldUseHashIndex);
+
+  double begin = now();
+  for (const std::shared_ptr<ndn::Data>& data : m_packets) {
+    cs.insert(*data);
+  }
+  double insertTime = now() - begin;
+
+  double hitTime = runLookups(cs, makeInterests(m_hitNames));
+  double missTime = runLookups(cs, makeInterests(m_missNames));
+
+  std::cout << m_packets.size() << "\t"
+            << (shouldUseHashIndex ? "hash" : "ordered") << "\t"
+            << 1000000000 * insertTime / m_packets.size() << "\t"
+            << 1000000000 * hitTime / m_nLookups << "\t"
+            << 1000000000 * missTime / m_nLookups << "\n";
+}
+
+double
+CsBenchmark::runMemory(bool shouldKeepData)
+{
+  std::vector<std::shared_ptr<const ndn::Data>> keptData;
+  keptData.reserve(shouldKeepData ? m_packets.size() : 0);
+
+  nfd::Cs cs(m_packets.size());
+  int64_t before = MemUsage::Get();
+  for (const std::shared_ptr<ndn::Data>& packet : m_packets) {
+    const ::ndn::Block& wire = packet->wireEncode();
+    auto data = std::make_shared<ndn::Data>(::ndn::Block(wire.wire(), wire.size()));
+    cs.insert(*data);
+    if (shouldKeepData) {
+      keptData.push_back(data);
+    }
+  }
+  return static_cast<double>(MemUsage::Get() - before) / m_packets.size();
+}
+
+int
+CsBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("max", "Largest number of cached packets", m_maxNPackets);
+  cmd.AddValue("lookups", "Number of lookups per measurement", m_nLookups);
+  cmd.AddValue("memory", "Measure memory per entry instead of latency (legacy or current)",
+               m_memoryMode);
+  cmd.Parse(argc, argv);
+
+  if (!m_memoryMode.empty()) {
+    makePackets(m_maxNPackets);
+    double bytesPerEntry = runMemory(m_memoryMode == "legacy");
+    std::cout << "Packets"
+              << "\t"
+              << "Entries"
+              << "\t"
+              << "Bytes/entry"
+              << "\n"
+              << m_maxNPackets << "\t" << m_memoryMode << "\t" << bytesPerEntry << "\n";
+    return 0;
+  }
+
+  std::cout << "Packets"
+            << "\t"
+            << "Index"
+            << "\t"
+            << "Insert (ns)"
+            << "\t"
+            << "Hit (ns)"
+            << "\t"
+            << "Miss (ns)"
+            << "\n";
+
+  for (size_t nPackets = 100000; nPackets <= m_maxNPackets; nPackets *= 10) {
+    makePackets(nPackets);
+    runIndex(false);
+    runIndex(true);
+  }
+
+  std::cerr << "checksum: " << m_checksum << std::endl;
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::CsBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
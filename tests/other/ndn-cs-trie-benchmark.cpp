@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-trie-benchmark.cpp
+
+#include "ns3/core-module.h"
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/radix-trie.hpp"
+#include "ns3/ndnSIM/utils/trie/lru-policy.hpp"
+
+#include <sys/time.h>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Compares the name index of the old ndnSIM content stores (ContentStoreImpl) when backed by
+ * the classic trie ("classic") and by the path-compressed trie ("radix"), for 10^5 to 10^6
+ * cached names of the form /ndn/<site>/<object>/<segment>.
+ *
+ * Hits look up the Name of a cached packet, misses a segment of a cached object that is not
+ * cached, both with deepest_prefix_match as ContentStoreImpl::Lookup does.
+ *
+ * With --memory, it instead reports the growth of the resident set per cached name for --max
+ * names, not counting the names and payloads themselves. Run each in its own process, as freed
+ * memory is not returned.
+ *
+ *     ./waf --run ndn-cs-trie-benchmark --command-template="%s --max=1000000"
+ *     ./waf --run ndn-cs-trie-benchmark --command-template="%s --max=1000000 --memory=classic"
+ *     ./waf --run ndn-cs-trie-benchmark --command-template="%s --max=1000000 --memory=radix"
+ */
+class CsTrieBenchmark {
+public:
+  struct Payload {
+  };
+
+  typedef ndn::ndnSIM::pointer_payload_traits<Payload> PayloadTraits;
+
+  typedef ndn::ndnSIM::trie_with_policy<ndn::Name, PayloadTraits, ndn::ndnSIM::lru_policy_traits>
+    ClassicTrie;
+
+  typedef ndn::ndnSIM::trie_with_policy<ndn::Name, PayloadTraits, ndn::ndnSIM::lru_policy_traits,
+                                        ndn::ndnSIM::radix_trie> RadixTrie;
+
+public:
+  CsTrieBenchmark()
+    : m_maxNNames(1000000)
+    , m_nLookups(1000000)
+    , m_checksum(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  makeNames(size_t nNames);
+
+  template<class Trie>
+  double
+  runLookups(Trie& trie, const std::vector<ndn::Name>& names);
+
+  template<class Trie>
+  void
+  runTrie(const std::string& trieName);
+
+  template<class Trie>
+  double
+  runMemory();
+
+private:
+  uint32_t m_maxNNames;
+  uint32_t m_nLookups;
+  std::string m_memoryMode;
+  std::vector<ndn::Name> m_names;
+  std::vector<ndn::Name> m_hitNames;
+  std::vector<ndn::Name> m_missNames;
+  Payload m_payload;
+  uint64_t m_checksum; ///< keeps the compiler from dropping the measured loops
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+void
+CsTrieBenchmark::makeNames(size_t nNames)
+{
+  std::mt19937 rng(nNames);
+  std::uniform_int_distribution<int> site(0, 99);
+  std::uniform_int_distribution<int> object(0, 9999);
+
+  m_names.clear();
+  m_names.reserve(nNames);
+  std::vector<ndn::Name> missNames;
+  for (size_t i = 0; i < nNames; ++i) {
+    ndn::Name prefix("/ndn");
+    prefix.append("site" + std::to_string(site(rng)));
+    prefix.append("object" + std::to_string(object(rng)));
+
+    m_names.push_back(ndn::Name(prefix).appendSegment(i));
+    missNames.push_back(ndn::Name(prefix).appendSegment(nNames + i));
+  }
+
+  std::uniform_int_distribution<size_t> index(0, nNames - 1);
+  m_hitNames.resize(m_nLookups);
+  m_missNames.resize(m_nLookups);
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    m_hitNames[i] = m_names[index(rng)];
+    m_missNames[i] = missNames[index(rng)];
+  }
+}
+
+template<class Trie>
+double
+CsTrieBenchmark::runLookups(Trie& trie, const std::vector<ndn::Name>& names)
+{
+  double begin = now();
+  for (const ndn::Name& name : names) {
+    if (trie.deepest_prefix_match(name) != trie.end()) {
+      ++m_checksum;
+    }
+  }
+  return now() - begin;
+}
+
+template<class Trie>
+void
+CsTrieBenchmark::runTrie(const std::string& trieName)
+{
+  Trie trie;
+  trie.getPolicy().set_max_size(m_names.size());
+
+  double begin = now();
+  for (const ndn::Name& name : m_names) {
+    trie.insert(name, &m_payload);
+  }
+  double insertTime = now() - begin;
+
+  double hitTime = runLookups(trie, m_hitNames);
+  double missTime = runLookups(trie, m_missNames);
+
+  std::cout << m_names.size() << "\t" << trieName << "\t"
+            << 1000000000 * insertTime / m_names.size() << "\t"
+            << 1000000000 * hitTime / m_nLookups << "\t"
+            << 1000000000 * missTime / m_nLookups << "\n";
+}
+
+template<class Trie>
+double
+CsTrieBenchmark::runMemory()
+{
+  int64_t before = MemUsage::Get();
+  Trie* trie = new Trie; // not freed, so that nothing is released before the measurement
+  trie->getPolicy().set_max_size(m_names.size());
+  for (const ndn::Name& name : m_names) {
+    trie->insert(name, &m_payload);
+  }
+  return static_cast<double>(MemUsage::Get() - before) / m_names.size();
+}
+
+int
+CsTrieBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("max", "Largest number of cached names", m_maxNNames);
+  cmd.AddValue("lookups", "Number of lookups per measurement", m_nLookups);
+  cmd.AddValue("memory", "Measure memory per name instead of latency (classic or radix)",
+               m_memoryMode);
+  cmd.Parse(argc, argv);
+
+  if (!m_memoryMode.empty()) {
+    makeNames(m_maxNNames);
+    double bytesPerName =
+      m_memoryMode == "classic" ? runMemory<ClassicTrie>() : runMemory<RadixTrie>();
+    std::cout << "Names"
+              << "\t"
+              << "Trie"
+              << "\t"
+              << "Bytes/name"
+              << "\n"
+              << m_maxNNames << "\t" << m_memoryMode << "\t" << bytesPerName << "\n";
+    return 0;
+  }
+
+  std::cout << "Names"
+            << "\t"
+            << "Trie"
+            << "\t"
+            << "Insert (ns)"
+            << "\t"
+            << "Hit (ns)"
+            << "\t"
+            << "Miss (ns)"
+            << "\n";
+
+  for (size_t nNames = 100000; nNames <= m_maxNNames; nNames *= 10) {
+    makeNames(nNames);
+    runTrie<ClassicTrie>("classic");
+    runTrie<RadixTrie>("radix");
+  }
+
+  std::cerr << "checksum: " << m_checksum << std::endl;
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::CsTrieBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
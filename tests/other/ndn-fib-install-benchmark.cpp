@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-fib-install-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+namespace ns3 {
+
+/**
+ * Compares the two ways of adding routes with ndn::FibHelper, for 10^3 to 10^5 prefixes on one
+ * node: "command" calls FibHelper::AddRoute for each route, which signs and dispatches a FIB
+ * management command, "batch" passes all of them to FibHelper::AddRoutes.  Times are those
+ * reported by FibHelper::GetInstallStats().
+ *
+ *     ./waf --run ndn-fib-install-benchmark --command-template="%s --max=100000"
+ */
+class FibInstallBenchmark {
+public:
+  FibInstallBenchmark()
+    : m_maxNPrefixes(100000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  double
+  runCommands(Ptr<Node> node, shared_ptr<ndn::Face> face, const std::vector<ndn::Name>& prefixes);
+
+  double
+  runBatch(Ptr<Node> node, shared_ptr<ndn::Face> face, const std::vector<ndn::Name>& prefixes);
+
+private:
+  uint32_t m_maxNPrefixes;
+};
+
+/**
+ * @return face of the only link of @p node
+ */
+static shared_ptr<ndn::Face>
+getLinkFace(Ptr<Node> node)
+{
+  return node->GetObject<ndn::L3Protocol>()->getFaceByNetDevice(node->GetDevice(0));
+}
+
+double
+FibInstallBenchmark::runCommands(Ptr<Node> node, shared_ptr<ndn::Face> face,
+                                 const std::vector<ndn::Name>& prefixes)
+{
+  ndn::FibHelper::ResetInstallStats();
+  for (const ndn::Name& prefix : prefixes) {
+    ndn::FibHelper::AddRoute(node, prefix, face, 1);
+  }
+  return ndn::FibHelper::GetInstallStats().seconds;
+}
+
+double
+FibInstallBenchmark::runBatch(Ptr<Node> node, shared_ptr<ndn::Face> face,
+                              const std::vector<ndn::Name>& prefixes)
+{
+  std::vector<ndn::FibHelper::Route> routes;
+  routes.reserve(prefixes.size());
+  for (const ndn::Name& prefix : prefixes) {
+    routes.emplace_back(prefix, face, 1);
+  }
+
+  ndn::FibHelper::ResetInstallStats();
+  ndn::FibHelper::AddRoutes(node, routes);
+  return ndn::FibHelper::GetInstallStats().seconds;
+}
+
+int
+FibInstallBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("max", "Largest number of prefixes", m_maxNPrefixes);
+  cmd.Parse(argc, argv);
+
+  // one node per measurement, so that each starts with an empty FIB
+  size_t nMeasurements = 0;
+  for (size_t nPrefixes = 1000; nPrefixes <= m_maxNPrefixes; nPrefixes *= 10) {
+    nMeasurements += 2;
+  }
+
+  NodeContainer nodes;
+  nodes.Create(nMeasurements + 1);
+  PointToPointHelper p2p;
+  for (size_t i = 0; i < nMeasurements; ++i) {
+    p2p.Install(nodes.Get(i), nodes.Get(nMeasurements));
+  }
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  std::cout << "Prefixes"
+            << "\t"
+            << "Command (routes/s)"
+            << "\t"
+            << "Batch (routes/s)"
+            << "\t"
+            << "Speedup"
+            << "\n";
+
+  size_t nodeIndex = 0;
+  for (size_t nPrefixes = 1000; nPrefixes <= m_maxNPrefixes; nPrefixes *= 10) {
+    std::vector<ndn::Name> prefixes;
+    for (size_t i = 0; i < nPrefixes; ++i) {
+      prefixes.push_back(ndn::Name("/as" + std::to_string(i % 100)).append("prefix" +
+                                                                           std::to_string(i)));
+    }
+
+    Ptr<Node> commandNode = nodes.Get(nodeIndex++);
+    double commandTime = runCommands(commandNode, getLinkFace(commandNode), prefixes);
+
+    Ptr<Node> batchNode = nodes.Get(nodeIndex++);
+    double batchTime = runBatch(batchNode, getLinkFace(batchNode), prefixes);
+
+    std::cout << nPrefixes << "\t"
+              << nPrefixes / commandTime << "\t"
+              << nPrefixes / batchTime << "\t"
+              << commandTime / batchTime << "\n";
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::FibInstallBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
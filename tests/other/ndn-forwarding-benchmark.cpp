@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-forwarding-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/ndn-ns3.hpp"
+
+#include <sys/time.h>
+
+namespace ns3 {
+
+/**
+ * Measures per-hop forwarding cost of Data packets on a chain topology:
+ *
+ *      +----------+     +--------+           +--------+     +----------+
+ *      | consumer | <-> | router | <-> ... <-> | router | <-> | producer |
+ *      +----------+     +--------+           +--------+     +----------+
+ *
+ * Caching is disabled so every Data traverses the whole chain.
+ *
+ *     ./waf --run ndn-forwarding-benchmark --command-template="%s --reuse=1 --hops=10"
+ *     ./waf --run ndn-forwarding-benchmark --command-template="%s --reuse=0 --hops=10"
+ */
+class ForwardingBenchmark {
+public:
+  ForwardingBenchmark()
+    : m_nHops(10)
+    , m_interestRate(10000)
+    , m_payloadSize(1024)
+    , m_shouldReuse(true)
+    , m_simulationTime(Seconds(10))
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  uint32_t m_nHops;
+  double m_interestRate;
+  uint32_t m_payloadSize;
+  bool m_shouldReuse;
+  Time m_simulationTime;
+};
+
+int
+ForwardingBenchmark::run(int argc, char* argv[])
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10000Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("1000"));
+
+  CommandLine cmd;
+  cmd.AddValue("hops", "Number of links in the chain", m_nHops);
+  cmd.AddValue("rate", "Interest rate", m_interestRate);
+  cmd.AddValue("payload", "Data payload size", m_payloadSize);
+  cmd.AddValue("reuse", "Reuse received packets when forwarding unmodified Data", m_shouldReuse);
+  cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.Parse(argc, argv);
+
+  ndn::Convert::setWirePacketReuse(m_shouldReuse);
+
+  NodeContainer nodes;
+  nodes.Create(m_nHops + 1);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 0; i < m_nHops; ++i) {
+    p2p.Install(nodes.Get(i), nodes.Get(i + 1));
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(1);
+  ndnHelper.InstallAll();
+
+  for (uint32_t i = 0; i < m_nHops; ++i) {
+    ndn::FibHelper::AddRoute(nodes.Get(i), "/prefix", nodes.Get(i + 1), 1);
+  }
+  ndn::StrategyChoiceHelper::InstallAll("/", "/localhost/nfd/strategy/best-route");
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+  consumerHelper.Install(nodes.Get(0));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", UintegerValue(m_payloadSize));
+  producerHelper.Install(nodes.Get(m_nHops));
+
+  Simulator::Stop(m_simulationTime);
+
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  double beginRealTime = t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+
+  Simulator::Run();
+
+  gettimeofday(&t, NULL);
+  double realTime = t.tv_sec + (0.000001 * (unsigned)t.tv_usec) - beginRealTime;
+
+  // every outgoing Data on a router or the producer is one hop
+  uint64_t nDataHops = 0;
+  for (uint32_t i = 1; i <= m_nHops; ++i) {
+    nDataHops += nodes.Get(i)->GetObject<ndn::L3Protocol>()->getForwarder()
+                   ->getCounters().getNOutDatas();
+  }
+
+  Simulator::Destroy();
+
+  std::cout << "Reuse"
+            << "\t"
+            << "Hops"
+            << "\t"
+            << "PayloadSize"
+            << "\t"
+            << "RealTime"
+            << "\t"
+            << "DataHops"
+            << "\t"
+            << "PerHop (us)"
+            << "\n";
+  std::cout << m_shouldReuse << "\t"
+            << m_nHops << "\t"
+            << m_payloadSize << "\t"
+            << realTime << "\t"
+            << nDataHops << "\t"
+            << (nDataHops > 0 ? 1000000 * realTime / nDataHops : 0) << "\n";
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ForwardingBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
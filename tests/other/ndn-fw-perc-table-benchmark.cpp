@@ -0,0 +1,307 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-fw-perc-table-benchmark.cpp
+
+#include "ns3/core-module.h"
+
+#include "fw/mt-forwarding-info.hpp"
+
+#include <sys/time.h>
+#include <map>
+
+namespace ns3 {
+
+/**
+ * Microbenchmark of the forwarding percentage table of PconStrategy (nfd::fw::MtForwardingInfo).
+ *
+ * For 2 to 16 next hops, measures the per-Interest work (summing the percentages of the eligible
+ * faces and choosing one of them) and the per-Data work (moving part of the percentage of one
+ * face to the others).  "Legacy" replays the previous std::map based table, "current" uses the
+ * flat table with its cumulative distribution and "alias" the cached alias table that
+ * PconStrategy samples from.
+ *
+ *     ./waf --run ndn-fw-perc-table-benchmark --command-template="%s --n=1000000"
+ */
+class FwPercTableBenchmark {
+public:
+  FwPercTableBenchmark()
+    : m_nIterations(1000000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  double
+  runLegacyInterests(size_t nFaces);
+
+  double
+  runCurrentInterests(size_t nFaces);
+
+  double
+  runAliasInterests(size_t nFaces);
+
+  double
+  runLegacyData(size_t nFaces);
+
+  double
+  runCurrentData(size_t nFaces);
+
+private:
+  uint32_t m_nIterations;
+  uint64_t m_checksum; ///< keeps the compiler from dropping the measured loops
+};
+
+/**
+ * The std::map based table used by MtForwardingInfo before, kept here as a reference
+ */
+class LegacyForwardingInfo {
+public:
+  double
+  getforwPerc(nfd::FaceId face)
+  {
+    assert(m_forwPercMap.find(face) != m_forwPercMap.end());
+    return m_forwPercMap.at(face);
+  }
+
+  void
+  setforwPerc(nfd::FaceId faceId, double perc)
+  {
+    m_forwPercMap[faceId] = perc;
+  }
+
+  void
+  increaseforwPerc(nfd::FaceId faceId, double changeRate)
+  {
+    m_forwPercMap[faceId] += changeRate;
+  }
+
+  const std::map<nfd::FaceId, double>
+  getForwPercMap() const
+  {
+    return m_forwPercMap;
+  }
+
+  int
+  getFaceCount()
+  {
+    std::vector<nfd::FaceId> faceIdList;
+    for (auto faceInfo : m_forwPercMap) {
+      faceIdList.push_back(faceInfo.first);
+    }
+    return faceIdList.size();
+  }
+
+  // previous StrHelper::reduceFwPerc
+  void
+  reduceFwPerc(nfd::FaceId reducedFaceId, double change)
+  {
+    if (getFaceCount() == 1) {
+      return;
+    }
+
+    double changeRate = 0 - std::min(change, getforwPerc(reducedFaceId));
+    increaseforwPerc(reducedFaceId, changeRate);
+    const auto forwMap = getForwPercMap();
+    for (auto f : forwMap) {
+      if (f.first != reducedFaceId) {
+        increaseforwPerc(f.first, std::abs(changeRate / (double)(forwMap.size() - 1)));
+      }
+    }
+  }
+
+private:
+  std::map<nfd::FaceId, double> m_forwPercMap;
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+static double
+random01(uint32_t i)
+{
+  // cheap deterministic sequence, identical for both variants
+  return static_cast<double>((i * 2654435761u) >> 8) / (1 << 24);
+}
+
+double
+FwPercTableBenchmark::runLegacyInterests(size_t nFaces)
+{
+  LegacyForwardingInfo info;
+  std::vector<nfd::FaceId> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    faces.push_back(256 + i);
+    info.setforwPerc(256 + i, 1.0 / nFaces);
+  }
+
+  double begin = now();
+  for (uint32_t i = 0; i < m_nIterations; ++i) {
+    double percSum = 0;
+    for (nfd::FaceId face : faces) {
+      percSum += info.getforwPerc(face);
+    }
+
+    double r = random01(i);
+    double forwPerc = 0;
+    for (nfd::FaceId face : faces) {
+      forwPerc += info.getforwPerc(face) / percSum;
+      if (r < forwPerc) {
+        m_checksum += face + (percSum > 0);
+        break;
+      }
+    }
+  }
+  return now() - begin;
+}
+
+double
+FwPercTableBenchmark::runCurrentInterests(size_t nFaces)
+{
+  nfd::fw::MtForwardingInfo info;
+  std::vector<nfd::FaceId> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    faces.push_back(256 + i);
+    info.setforwPerc(256 + i, 1.0 / nFaces);
+  }
+
+  double begin = now();
+  for (uint32_t i = 0; i < m_nIterations; ++i) {
+    double percSum = 0;
+    for (size_t j = 0; j < faces.size(); ++j) {
+      percSum += info.getforwPercAt(info.findIndex(faces[j], j));
+    }
+
+    m_checksum += info.getFaceIdAt(info.selectIndex(random01(i))) + (percSum > 0);
+  }
+  return now() - begin;
+}
+
+double
+FwPercTableBenchmark::runAliasInterests(size_t nFaces)
+{
+  nfd::fw::MtForwardingInfo info;
+  std::vector<nfd::FaceId> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    faces.push_back(256 + i);
+    info.setforwPerc(256 + i, 1.0 / nFaces);
+  }
+
+  double begin = now();
+  for (uint32_t i = 0; i < m_nIterations; ++i) {
+    uint64_t mask = 0;
+    double percSum = 0;
+    for (size_t j = 0; j < faces.size(); ++j) {
+      size_t index = info.findIndex(faces[j], j);
+      mask |= uint64_t(1) << index;
+      percSum += info.getforwPercAt(index);
+    }
+
+    m_checksum += info.getFaceIdAt(info.sampleIndex(random01(i), mask)) + (percSum > 0);
+  }
+  return now() - begin;
+}
+
+double
+FwPercTableBenchmark::runLegacyData(size_t nFaces)
+{
+  LegacyForwardingInfo info;
+  for (size_t i = 0; i < nFaces; ++i) {
+    info.setforwPerc(256 + i, 1.0 / nFaces);
+  }
+
+  double begin = now();
+  for (uint32_t i = 0; i < m_nIterations; ++i) {
+    info.reduceFwPerc(256 + i % nFaces, 0.02 * info.getforwPerc(256 + i % nFaces));
+  }
+  m_checksum += info.getforwPerc(256);
+  return now() - begin;
+}
+
+double
+FwPercTableBenchmark::runCurrentData(size_t nFaces)
+{
+  nfd::fw::MtForwardingInfo info;
+  for (size_t i = 0; i < nFaces; ++i) {
+    info.setforwPerc(256 + i, 1.0 / nFaces);
+  }
+
+  double begin = now();
+  for (uint32_t i = 0; i < m_nIterations; ++i) {
+    info.reduceforwPerc(256 + i % nFaces, 0.02 * info.getforwPerc(256 + i % nFaces));
+  }
+  m_checksum += info.getforwPerc(256);
+  return now() - begin;
+}
+
+int
+FwPercTableBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("n", "Number of Interests and Data per next hop count", m_nIterations);
+  cmd.Parse(argc, argv);
+
+  m_checksum = 0;
+
+  std::cout << "NextHops"
+            << "\t"
+            << "Legacy Interest (ns)"
+            << "\t"
+            << "Current Interest (ns)"
+            << "\t"
+            << "Alias Interest (ns)"
+            << "\t"
+            << "Legacy Data (ns)"
+            << "\t"
+            << "Current Data (ns)"
+            << "\n";
+
+  for (size_t nFaces : {2, 4, 8, 16}) {
+    double legacyInterests = runLegacyInterests(nFaces);
+    double currentInterests = runCurrentInterests(nFaces);
+    double aliasInterests = runAliasInterests(nFaces);
+    double legacyData = runLegacyData(nFaces);
+    double currentData = runCurrentData(nFaces);
+
+    std::cout << nFaces << "\t"
+              << 1e9 * legacyInterests / m_nIterations << "\t"
+              << 1e9 * currentInterests / m_nIterations << "\t"
+              << 1e9 * aliasInterests / m_nIterations << "\t"
+              << 1e9 * legacyData / m_nIterations << "\t"
+              << 1e9 * currentData / m_nIterations << "\n";
+  }
+
+  std::cerr << "checksum: " << m_checksum << std::endl;
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::FwPercTableBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
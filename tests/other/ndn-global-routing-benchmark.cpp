@@ -0,0 +1,403 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-global-routing-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/ndn-net-device-face.hpp"
+#include "ns3/ndnSIM/helper/ndn-global-routing-snapshot.hpp"
+#include "ns3/ndnSIM/helper/boost-graph-ndn-global-routing-helper.hpp"
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <sys/time.h>
+
+namespace ns3 {
+
+/**
+ * Times the computation of the routes installed by ndn::GlobalRoutingHelper::CalculateRoutes
+ * (or CalculateAllPossibleRoutes with --all), without installing them, on a topology from
+ * examples/topologies or on a generated grid.  Every node originates one prefix.
+ *
+ * "Legacy" runs Dijkstra from every node directly on boost::NdnGlobalRouterGraph, "snapshot"
+ * uses ndn::GlobalRoutingSnapshot with 1, 2, 4, ... threads.  Routes of both are compared; the
+ * number of nodes whose routes differ is printed and must be zero.
+ *
+ * With --flaps, random links are then failed and recovered one by one, and the incremental
+ * update of shortest-path trees is timed against recomputing all of them.
+ *
+ *     ./waf --run ndn-global-routing-benchmark \
+ *       --command-template="%s --topology=src/ndnSIM/examples/topologies/topo-tree-25-node.txt"
+ *     ./waf --run ndn-global-routing-benchmark --command-template="%s --grid=40 --repeat=1"
+ */
+class GlobalRoutingBenchmark {
+public:
+  typedef std::vector<std::vector<ndn::FibHelper::Route>> RouteTable;
+
+  GlobalRoutingBenchmark()
+    : m_topology("src/ndnSIM/examples/topologies/topo-tree-25-node.txt")
+    , m_gridSize(0)
+    , m_repeat(10)
+    , m_maxNThreads(boost::thread::hardware_concurrency())
+    , m_shouldUseAllPaths(false)
+    , m_nFlaps(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  createTopology();
+
+  RouteTable
+  computeLegacy() const;
+
+  RouteTable
+  computeLegacyAllPaths() const;
+
+  RouteTable
+  computeSnapshot(uint32_t nThreads) const;
+
+  static size_t
+  countMismatches(const RouteTable& a, const RouteTable& b);
+
+  void
+  runFlaps() const;
+
+private:
+  std::string m_topology;
+  uint32_t m_gridSize;
+  uint32_t m_repeat;
+  uint32_t m_maxNThreads;
+  bool m_shouldUseAllPaths;
+  uint32_t m_nFlaps;
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+void
+GlobalRoutingBenchmark::createTopology()
+{
+  if (m_gridSize > 0) {
+    PointToPointHelper p2p;
+    PointToPointGridHelper grid(m_gridSize, m_gridSize, p2p);
+  }
+  else {
+    AnnotatedTopologyReader topologyReader("", 25);
+    topologyReader.SetFileName(m_topology);
+    topologyReader.Read();
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    ndnGlobalRoutingHelper.AddOrigin("/node" + std::to_string((*node)->GetId()), *node);
+  }
+}
+
+GlobalRoutingBenchmark::RouteTable
+GlobalRoutingBenchmark::computeLegacy() const
+{
+  boost::NdnGlobalRouterGraph graph;
+
+  RouteTable routeTable;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<ndn::GlobalRouter> source = (*node)->GetObject<ndn::GlobalRouter>();
+    if (source == 0) {
+      continue;
+    }
+
+    boost::DistancesMap distances;
+    dijkstra_shortest_paths(graph, source,
+                            distance_map(boost::ref(distances))
+                              .distance_inf(boost::WeightInf)
+                              .distance_zero(boost::WeightZero)
+                              .distance_compare(boost::WeightCompare())
+                              .distance_combine(boost::WeightCombine()));
+
+    std::vector<ndn::FibHelper::Route> routes;
+    for (const auto& dist : distances) {
+      if (dist.first == source || std::get<0>(dist.second) == 0) {
+        continue;
+      }
+      for (const auto& prefix : dist.first->GetLocalPrefixes()) {
+        routes.emplace_back(*prefix, std::get<0>(dist.second), std::get<1>(dist.second));
+      }
+    }
+    routeTable.push_back(std::move(routes));
+  }
+  return routeTable;
+}
+
+GlobalRoutingBenchmark::RouteTable
+GlobalRoutingBenchmark::computeLegacyAllPaths() const
+{
+  const uint16_t disabledMetric = std::numeric_limits<uint16_t>::max() - 1;
+  boost::NdnGlobalRouterGraph graph;
+
+  RouteTable routeTable;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<ndn::GlobalRouter> source = (*node)->GetObject<ndn::GlobalRouter>();
+    if (source == 0) {
+      continue;
+    }
+
+    Ptr<ndn::L3Protocol> l3 = (*node)->GetObject<ndn::L3Protocol>();
+    std::vector<shared_ptr<ndn::Face>> faces;
+    std::vector<uint64_t> originalMetrics;
+    for (const auto& face : l3->getForwarder()->getFaceTable()) {
+      faces.push_back(face);
+      originalMetrics.push_back(face->getMetric());
+      face->setMetric(disabledMetric);
+    }
+
+    std::vector<ndn::FibHelper::Route> routes;
+    for (size_t i = 0; i < faces.size(); ++i) {
+      if (std::dynamic_pointer_cast<ndn::NetDeviceFace>(faces[i]) == nullptr) {
+        continue;
+      }
+      faces[i]->setMetric(originalMetrics[i]);
+
+      boost::DistancesMap distances;
+      dijkstra_shortest_paths(graph, source,
+                              distance_map(boost::ref(distances))
+                                .distance_inf(boost::WeightInf)
+                                .distance_zero(boost::WeightZero)
+                                .distance_compare(boost::WeightCompare())
+                                .distance_combine(boost::WeightCombine()));
+
+      for (const auto& dist : distances) {
+        if (dist.first == source || std::get<0>(dist.second) == 0 ||
+            std::get<0>(dist.second)->getMetric() == disabledMetric) {
+          continue;
+        }
+        for (const auto& prefix : dist.first->GetLocalPrefixes()) {
+          routes.emplace_back(*prefix, std::get<0>(dist.second), std::get<1>(dist.second));
+        }
+      }
+
+      faces[i]->setMetric(disabledMetric);
+    }
+
+    for (size_t i = 0; i < faces.size(); ++i) {
+      faces[i]->setMetric(originalMetrics[i]);
+    }
+    routeTable.push_back(std::move(routes));
+  }
+  return routeTable;
+}
+
+GlobalRoutingBenchmark::RouteTable
+GlobalRoutingBenchmark::computeSnapshot(uint32_t nThreads) const
+{
+  ndn::GlobalRoutingSnapshot snapshot;
+  ndn::GlobalRoutingSnapshot::ComputeFunction compute =
+    m_shouldUseAllPaths ? &ndn::GlobalRoutingSnapshot::computeAllPaths
+                        : &ndn::GlobalRoutingSnapshot::computeShortestPaths;
+
+  RouteTable routeTable;
+  for (const auto& nextHops : snapshot.computeAll(compute, nThreads)) {
+    routeTable.push_back(snapshot.makeRoutes(nextHops));
+  }
+  return routeTable;
+}
+
+size_t
+GlobalRoutingBenchmark::countMismatches(const RouteTable& a, const RouteTable& b)
+{
+  if (a.size() != b.size()) {
+    return std::max(a.size(), b.size());
+  }
+
+  size_t nMismatches = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    bool isEqual = a[i].size() == b[i].size() &&
+      std::equal(a[i].begin(), a[i].end(), b[i].begin(),
+                 [] (const ndn::FibHelper::Route& x, const ndn::FibHelper::Route& y) {
+                   return x.prefix == y.prefix && x.face == y.face && x.metric == y.metric;
+                 });
+    nMismatches += isEqual ? 0 : 1;
+  }
+  return nMismatches;
+}
+
+void
+GlobalRoutingBenchmark::runFlaps() const
+{
+  // both faces of every point-to-point link
+  std::vector<std::pair<shared_ptr<ndn::Face>, shared_ptr<ndn::Face>>> links;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<ndn::L3Protocol> l3 = (*node)->GetObject<ndn::L3Protocol>();
+    for (const auto& face : l3->getForwarder()->getFaceTable()) {
+      auto ndFace = std::dynamic_pointer_cast<ndn::NetDeviceFace>(face);
+      if (ndFace == nullptr || ndFace->GetNetDevice()->GetChannel()->GetNDevices() != 2) {
+        continue;
+      }
+      Ptr<Channel> channel = ndFace->GetNetDevice()->GetChannel();
+      Ptr<NetDevice> otherDevice = channel->GetDevice(0) == ndFace->GetNetDevice()
+                                     ? channel->GetDevice(1) : channel->GetDevice(0);
+      if (otherDevice->GetNode()->GetId() > (*node)->GetId()) {
+        links.emplace_back(face, otherDevice->GetNode()->GetObject<ndn::L3Protocol>()
+                                   ->getFaceByNetDevice(otherDevice));
+      }
+    }
+  }
+  if (links.empty()) {
+    return;
+  }
+
+  ndn::GlobalRoutingSnapshot snapshot;
+  ndn::GlobalRoutingSnapshot::ComputeFunction compute =
+    m_shouldUseAllPaths ? &ndn::GlobalRoutingSnapshot::computeAllPaths
+                        : &ndn::GlobalRoutingSnapshot::computeShortestPaths;
+  std::vector<ndn::GlobalRoutingSnapshot::TreeList> trees;
+  snapshot.computeAll(compute, 1, &trees);
+
+  size_t nTrees = 0;
+  for (const auto& sourceTrees : trees) {
+    nTrees += sourceTrees.size();
+  }
+
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+  size_t nRecomputed = 0;
+  double incrementalTime = 0;
+  double fullTime = 0;
+  size_t link = 0;
+  for (uint32_t i = 0; i < 2 * m_nFlaps; ++i) {
+    // odd events recover the link failed by the previous one
+    if (i % 2 == 0) {
+      link = random->GetInteger(0, links.size() - 1);
+    }
+    bool isUp = i % 2 == 1;
+    snapshot.setFaceUp(links[link].first, isUp);
+    snapshot.setFaceUp(links[link].second, isUp);
+
+    double startTime = now();
+    for (size_t n : snapshot.updateTrees(trees, 1)) {
+      nRecomputed += n;
+    }
+    incrementalTime += now() - startTime;
+
+    startTime = now();
+    snapshot.computeAll(compute, 1);
+    fullTime += now() - startTime;
+  }
+
+  std::cout << "\n"
+            << "Events"
+            << "\t"
+            << "Trees"
+            << "\t"
+            << "Recomputed/event"
+            << "\t"
+            << "Incremental (s/event)"
+            << "\t"
+            << "Full (s/event)"
+            << "\n";
+  std::cout << 2 * m_nFlaps << "\t"
+            << nTrees << "\t"
+            << static_cast<double>(nRecomputed) / (2 * m_nFlaps) << "\t"
+            << incrementalTime / (2 * m_nFlaps) << "\t"
+            << fullTime / (2 * m_nFlaps) << "\n";
+}
+
+int
+GlobalRoutingBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("topology", "Topology file in the format of examples/topologies", m_topology);
+  cmd.AddValue("grid", "If not 0, use a grid of grid x grid nodes instead of topology",
+               m_gridSize);
+  cmd.AddValue("repeat", "Number of times every computation is repeated", m_repeat);
+  cmd.AddValue("threads", "Largest number of threads", m_maxNThreads);
+  cmd.AddValue("all", "Compute routes of CalculateAllPossibleRoutes", m_shouldUseAllPaths);
+  cmd.AddValue("flaps", "Number of link failures and recoveries to update routes for", m_nFlaps);
+  cmd.Parse(argc, argv);
+
+  createTopology();
+
+  RouteTable legacyRoutes;
+  double startTime = now();
+  for (uint32_t i = 0; i < m_repeat; ++i) {
+    legacyRoutes = m_shouldUseAllPaths ? computeLegacyAllPaths() : computeLegacy();
+  }
+  double legacyTime = (now() - startTime) / m_repeat;
+
+  std::cout << "Nodes"
+            << "\t"
+            << "Threads"
+            << "\t"
+            << "Legacy (s)"
+            << "\t"
+            << "Snapshot (s)"
+            << "\t"
+            << "Speedup"
+            << "\t"
+            << "Mismatches"
+            << "\n";
+
+  for (uint32_t nThreads = 1; nThreads <= std::max(m_maxNThreads, 1u); nThreads *= 2) {
+    RouteTable snapshotRoutes;
+    startTime = now();
+    for (uint32_t i = 0; i < m_repeat; ++i) {
+      snapshotRoutes = computeSnapshot(nThreads);
+    }
+    double snapshotTime = (now() - startTime) / m_repeat;
+
+    std::cout << NodeList::GetNNodes() << "\t"
+              << nThreads << "\t"
+              << legacyTime << "\t"
+              << snapshotTime << "\t"
+              << legacyTime / snapshotTime << "\t"
+              << countMismatches(legacyRoutes, snapshotRoutes) << "\n";
+  }
+
+  if (m_nFlaps > 0) {
+    runFlaps();
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::GlobalRoutingBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-name-tree-storage-benchmark.cpp
+
+#include "ns3/core-module.h"
+
+#include "table/name-tree.hpp"
+
+#include <sys/time.h>
+#include <algorithm>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Compares the hash table layouts of nfd::NameTree (chained and open addressing) for 10^4 to
+ * 10^6 stored names.
+ *
+ * For each layout it reports the hash table memory per stored entry (bucket arrays and nodes,
+ * without the entries themselves), the mean latency of an exact match and of a longest prefix
+ * match for stored names in random order, and the longest single insertion, which includes
+ * the full rehash of the chained table on resize.
+ *
+ *     ./waf --run ndn-name-tree-storage-benchmark --command-template="%s --max=1000000"
+ */
+class NameTreeStorageBenchmark {
+public:
+  NameTreeStorageBenchmark()
+    : m_maxNNames(1000000)
+    , m_nLookups(1000000)
+    , m_checksum(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  makeNames(size_t nNames);
+
+  void
+  runStorage(nfd::name_tree::StorageType storageType);
+
+private:
+  uint32_t m_maxNNames;
+  uint32_t m_nLookups;
+  std::vector<ndn::Name> m_names;
+  std::vector<size_t> m_lookupOrder;
+  uint64_t m_checksum; ///< keeps the compiler from dropping the measured loops
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+void
+NameTreeStorageBenchmark::makeNames(size_t nNames)
+{
+  std::mt19937 rng(nNames);
+  std::uniform_int_distribution<int> site(0, 99);
+  std::uniform_int_distribution<int> object(0, 9999);
+
+  m_names.clear();
+  for (size_t i = 0; i < nNames; ++i) {
+    ndn::Name name("/ndn");
+    name.append("site" + std::to_string(site(rng)));
+    name.append("object" + std::to_string(object(rng)));
+    name.appendSegment(i);
+    m_names.push_back(name);
+  }
+
+  std::uniform_int_distribution<size_t> index(0, nNames - 1);
+  m_lookupOrder.resize(m_nLookups);
+  std::generate(m_lookupOrder.begin(), m_lookupOrder.end(), [&] { return index(rng); });
+}
+
+void
+NameTreeStorageBenchmark::runStorage(nfd::name_tree::StorageType storageType)
+{
+  nfd::NameTree nameTree(1024, storageType);
+
+  double maxInsertTime = 0;
+  double begin = now();
+  for (const ndn::Name& name : m_names) {
+    double insertBegin = now();
+    m_checksum += nameTree.lookup(name)->getHash();
+    maxInsertTime = std::max(maxInsertTime, now() - insertBegin);
+  }
+  double insertTime = now() - begin;
+
+  begin = now();
+  for (size_t i : m_lookupOrder) {
+    m_checksum += nameTree.findExactMatch(m_names[i])->getHash();
+  }
+  double exactTime = now() - begin;
+
+  begin = now();
+  for (size_t i : m_lookupOrder) {
+    m_checksum += nameTree.findLongestPrefixMatch(m_names[i])->getHash();
+  }
+  double lpmTime = now() - begin;
+
+  std::cout << m_names.size() << "\t"
+            << (storageType == nfd::name_tree::STORAGE_CHAINED ? "chained" : "open") << "\t"
+            << nameTree.size() << "\t"
+            << static_cast<double>(nameTree.getNReservedBytes()) / nameTree.size() << "\t"
+            << 1000000000 * insertTime / m_names.size() << "\t"
+            << 1000000 * maxInsertTime << "\t"
+            << 1000000000 * exactTime / m_lookupOrder.size() << "\t"
+            << 1000000000 * lpmTime / m_lookupOrder.size() << "\n";
+}
+
+int
+NameTreeStorageBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("max", "Largest number of stored names", m_maxNNames);
+  cmd.AddValue("lookups", "Number of lookups per measurement", m_nLookups);
+  cmd.Parse(argc, argv);
+
+  std::cout << "Names"
+            << "\t"
+            << "Storage"
+            << "\t"
+            << "Entries"
+            << "\t"
+            << "Bytes/entry"
+            << "\t"
+            << "Insert (ns)"
+            << "\t"
+            << "Max insert (us)"
+            << "\t"
+            << "Exact match (ns)"
+            << "\t"
+            << "LPM (ns)"
+            << "\n";
+
+  for (size_t nNames = 10000; nNames <= m_maxNNames; nNames *= 10) {
+    makeNames(nNames);
+    runStorage(nfd::name_tree::STORAGE_CHAINED);
+    runStorage(nfd::name_tree::STORAGE_OPEN_ADDRESSING);
+  }
+
+  std::cerr << "checksum: " << m_checksum << std::endl;
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::NameTreeStorageBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-producer-benchmark.cpp
+
+#include "ns3/core-module.h"
+
+#include "ns3/ndnSIM/utils/ndn-data-template.hpp"
+
+#include <sys/time.h>
+#include <algorithm>
+
+namespace ns3 {
+
+/**
+ * Compares the two ways ndn::Producer makes a Data packet for an Interest, in Data/s, for
+ * several payload sizes.
+ *
+ * "Legacy" builds and encodes every packet (UseDataTemplate=false), "template" copies the
+ * pre-encoded fields of a DataTemplate after the Name (UseDataTemplate=true).  Every packet of
+ * both is encoded and compared; the number of packets whose wire encoding differs is printed
+ * and must be zero.
+ *
+ *     ./waf --run ndn-producer-benchmark --command-template="%s --n=1000000"
+ */
+class ProducerBenchmark {
+public:
+  ProducerBenchmark()
+    : m_nPackets(1000000)
+    , m_checksum(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  std::shared_ptr<ndn::Data>
+  makeLegacyData(const ndn::Name& name, size_t payloadSize) const;
+
+  double
+  runLegacy(size_t payloadSize);
+
+  double
+  runTemplate(size_t payloadSize);
+
+  size_t
+  countMismatches(size_t payloadSize) const;
+
+private:
+  uint32_t m_nPackets;
+  std::vector<ndn::Name> m_names;
+  uint64_t m_checksum; ///< keeps the compiler from dropping the measured loops
+};
+
+static double
+now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+std::shared_ptr<ndn::Data>
+ProducerBenchmark::makeLegacyData(const ndn::Name& name, size_t payloadSize) const
+{
+  // Producer::OnInterest with default attributes and UseDataTemplate=false
+  auto data = std::make_shared<ndn::Data>();
+  data->setName(name);
+  data->setFreshnessPeriod(::ndn::time::milliseconds(0));
+
+  data->setContent(std::make_shared< ::ndn::Buffer>(payloadSize));
+
+  ::ndn::Signature signature;
+  ::ndn::SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+
+  signature.setInfo(signatureInfo);
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+
+  data->setSignature(signature);
+
+  data->wireEncode();
+  return data;
+}
+
+double
+ProducerBenchmark::runLegacy(size_t payloadSize)
+{
+  double begin = now();
+  for (const ndn::Name& name : m_names) {
+    m_checksum += makeLegacyData(name, payloadSize)->wireEncode().size();
+  }
+  return now() - begin;
+}
+
+double
+ProducerBenchmark::runTemplate(size_t payloadSize)
+{
+  double begin = now();
+  ndn::DataTemplate dataTemplate(*makeLegacyData(ndn::Name(), payloadSize));
+  for (const ndn::Name& name : m_names) {
+    m_checksum += dataTemplate.makeData(name)->wireEncode().size();
+  }
+  return now() - begin;
+}
+
+size_t
+ProducerBenchmark::countMismatches(size_t payloadSize) const
+{
+  ndn::DataTemplate dataTemplate(*makeLegacyData(ndn::Name(), payloadSize));
+
+  size_t nMismatches = 0;
+  for (const ndn::Name& name : m_names) {
+    const ::ndn::Block& legacy = makeLegacyData(name, payloadSize)->wireEncode();
+    const ::ndn::Block& current = dataTemplate.makeData(name)->wireEncode();
+    if (legacy.size() != current.size() ||
+        !std::equal(legacy.begin(), legacy.end(), current.begin())) {
+      ++nMismatches;
+    }
+  }
+  return nMismatches;
+}
+
+int
+ProducerBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("n", "Number of Data packets per measurement", m_nPackets);
+  cmd.Parse(argc, argv);
+
+  // Interest names arrive encoded, as they are decoded from the wire
+  m_names.clear();
+  for (uint32_t i = 0; i < m_nPackets; ++i) {
+    m_names.push_back(ndn::Name("/prefix").appendSequenceNumber(i));
+    m_names.back().wireEncode();
+  }
+
+  std::cout << "Payload (bytes)"
+            << "\t"
+            << "Legacy (Data/s)"
+            << "\t"
+            << "Template (Data/s)"
+            << "\t"
+            << "Speedup"
+            << "\t"
+            << "Mismatches"
+            << "\n";
+
+  for (size_t payloadSize : {0, 1024, 8192}) {
+    double legacyTime = runLegacy(payloadSize);
+    double templateTime = runTemplate(payloadSize);
+
+    std::cout << payloadSize << "\t"
+              << m_nPackets / legacyTime << "\t"
+              << m_nPackets / templateTime << "\t"
+              << legacyTime / templateTime << "\t"
+              << countMismatches(payloadSize) << "\n";
+  }
+
+  std::cerr << "checksum: " << m_checksum << std::endl;
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ProducerBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
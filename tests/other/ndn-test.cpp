@@ -28,6 +28,8 @@
 #include "ns3/ndnSIM/utils/mem-usage.hpp"
 #include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
 #include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit.hpp"
+#include "ns3/ndnSIM/NFD/core/scheduler.hpp"
 
 namespace ns3 {
 
@@ -48,7 +50,14 @@ public:
   Tester()
     : m_csSize(100)
     , m_interestRate(1000)
+    , m_nZipfContents(0)
     , m_shouldEvaluatePit(false)
+    , m_shouldPoolPitEntries(true)
+    , m_shouldUseOpenNameTree(false)
+    , m_shouldUseCsHashIndex(false)
+    , m_shouldUseDnlBloomFilter(false)
+    , m_nLastScheduledEvents(0)
+    , m_nLastCancelledEvents(0)
     , m_simulationTime(Seconds(2000) / m_interestRate)
   {
   }
@@ -66,9 +75,16 @@ private:
   std::string m_oldContentStore;
   size_t m_csSize;
   double m_interestRate;
+  uint32_t m_nZipfContents;
   bool m_shouldEvaluatePit;
+  bool m_shouldPoolPitEntries;
+  bool m_shouldUseOpenNameTree;
+  bool m_shouldUseCsHashIndex;
+  bool m_shouldUseDnlBloomFilter;
   std::string m_strategy;
   double m_initialOverhead;
+  uint64_t m_nLastScheduledEvents;
+  uint64_t m_nLastCancelledEvents;
   Time m_simulationTime;
 };
 
@@ -104,12 +120,19 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
 
   uint64_t pitCount = 0;
   uint64_t csCount = 0;
+  uint64_t dnlCount = 0;
+  uint64_t nDnlFalsePositives = 0;
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
 
     auto pitSize = (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getPit().size();
     if (pitSize != 0)
       pitCount += pitSize;
 
+    const nfd::DeadNonceList& dnl =
+      (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getDeadNonceList();
+    dnlCount += dnl.size();
+    nDnlFalsePositives += dnl.getNFalsePositives();
+
     if (true != true) {
       Ptr<ndn::ContentStore> cs = (*node)->GetObject<ndn::ContentStore>();
       if (cs != 0)
@@ -124,6 +147,20 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
 
   os << "pit:" << pitCount << "\t";
   os << "cs:" << csCount << "\t";
+  os << "dnl:" << dnlCount << "\t";
+  if (m_shouldUseDnlBloomFilter) {
+    os << "dnl false positives:" << nDnlFalsePositives << "\t";
+  }
+
+  // NFD timer activity (PIT unsatisfy/straggler timers, Measurements cleanup, ...) per
+  // simulated second since the previous line
+  uint64_t nScheduledEvents = nfd::scheduler::getNScheduledEvents();
+  uint64_t nCancelledEvents = nfd::scheduler::getNCancelledEvents();
+  double interval = nextPrintTime.ToDouble(Time::S);
+  os << "timers scheduled/s:" << (nScheduledEvents - m_nLastScheduledEvents) / interval << "\t";
+  os << "timers cancelled/s:" << (nCancelledEvents - m_nLastCancelledEvents) / interval << "\t";
+  m_nLastScheduledEvents = nScheduledEvents;
+  m_nLastCancelledEvents = nCancelledEvents;
 
   os << MemUsage::Get() / 1024.0 / 1024.0 << "MiB\n";
 
@@ -133,6 +170,13 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
       if (pitCount != 0) {
         os << "Approximate memory overhead per PIT entry:"
            <<  1000 * (finalOverhead - m_initialOverhead) / pitCount << "KiB\n";
+
+        const nfd::FixedSizePool& pool = nfd::Pit::getEntryPool();
+        os << "sizeof(pit::Entry): " << sizeof(nfd::pit::Entry) << "B, "
+           << "pooled PIT entries: " << (m_shouldPoolPitEntries ? "yes" : "no") << ", "
+           << "pool chunk: " << pool.getChunkSize() << "B, "
+           << "pool reserved: " << pool.getNReservedBytes() / 1024.0 << "KiB, "
+           << "open addressing name tree: " << (m_shouldUseOpenNameTree ? "yes" : "no") << "\n";
       }
       else {
         os << "`The number of PIT entries is equal to zero\n";
@@ -141,7 +185,8 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
     else {
       if (csCount != 0) {
         os << "Approximate memory overhead per CS entry:"
-           <<  1000 * (finalOverhead - m_initialOverhead) / csCount << "KiB\n";
+           <<  1000 * (finalOverhead - m_initialOverhead) / csCount << "KiB, "
+           << "CS hash index: " << (m_shouldUseCsHashIndex ? "yes" : "no") << "\n";
       }
       else {
         os << "The number of CS entries is equal to zero\n";
@@ -168,8 +213,21 @@ Tester::run(int argc, char* argv[])
                m_oldContentStore);
   cmd.AddValue("cs-size", "Maximum number of cached packets per node", m_csSize);
   cmd.AddValue("rate", "Interest rate", m_interestRate);
+  cmd.AddValue("zipf", "Request this many contents with Zipf-Mandelbrot popularity, so that most "
+                       "Interests hit the consumer's CS (0: every Interest asks for a new name)",
+               m_nZipfContents);
   cmd.AddValue("pit", "Perform PIT evaluation if this parameter is true",
                m_shouldEvaluatePit);
+  cmd.AddValue("pit-pool", "Allocate PIT entries from a pool (false: one heap allocation each)",
+               m_shouldPoolPitEntries);
+  cmd.AddValue("open-name-tree", "Use the open addressing NameTree layout (false: chained)",
+               m_shouldUseOpenNameTree);
+  cmd.AddValue("cs-hash-index", "Look up NFD's CS through a hash index first "
+                                "(false: ordered table only)",
+               m_shouldUseCsHashIndex);
+  cmd.AddValue("dnl-bloom", "Keep NFD's Dead Nonce List in a Bloom filter and count its false "
+                            "positives (false: exact index only)",
+               m_shouldUseDnlBloomFilter);
   cmd.AddValue("strategy", "Choose forwarding strategy "
                            "(e.g., /localhost/nfd/strategy/multicast, "
                            "/localhost/nfd/strategy/best-route, ...) ",
@@ -177,6 +235,16 @@ Tester::run(int argc, char* argv[])
   cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
   cmd.Parse(argc, argv);
 
+  nfd::Pit::setEntryPooling(m_shouldPoolPitEntries);
+  nfd::NameTree::setDefaultStorageType(m_shouldUseOpenNameTree ?
+                                       nfd::name_tree::STORAGE_OPEN_ADDRESSING :
+                                       nfd::name_tree::STORAGE_CHAINED);
+  nfd::Cs::setDefaultHashIndex(m_shouldUseCsHashIndex);
+  nfd::DeadNonceList::BloomFilterOptions dnlOptions;
+  dnlOptions.isEnabled = m_shouldUseDnlBloomFilter;
+  dnlOptions.shouldCountFalsePositives = m_shouldUseDnlBloomFilter;
+  nfd::DeadNonceList::setDefaultBloomFilterOptions(dnlOptions);
+
   // Creating nodes
   NodeContainer nodes;
   nodes.Create(2);
@@ -203,10 +271,14 @@ Tester::run(int argc, char* argv[])
   // Installing applications
 
   // Consumer
-  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  ndn::AppHelper consumerHelper(m_nZipfContents != 0 ? "ns3::ndn::ConsumerZipfMandelbrot"
+                                                     : "ns3::ndn::ConsumerCbr");
   // Consumer will request /prefix/0, /prefix/1, ...
   consumerHelper.SetPrefix("/prefix");
   consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+  if (m_nZipfContents != 0) {
+    consumerHelper.SetAttribute("NumberOfContents", UintegerValue(m_nZipfContents));
+  }
   consumerHelper.Install(nodes.Get(0)); // first node
 
   if (!m_shouldEvaluatePit) {
@@ -29,6 +29,20 @@ echo "Using best route forwarding strategy.."
 
 echo
 
+# PIT entries allocated one by one (no pool), for comparison
+echo "Using best route forwarding strategy without PIT entry pool.."
+
+../../../waf --run ndn-test --command-template="%s --old-cs=ns3::ndn::cs::Lru --cs-size=${size} --rate=${rate} --pit=$(true) --pit-pool=false --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
+# open addressing NameTree, for comparison
+echo "Using best route forwarding strategy with open addressing NameTree.."
+
+../../../waf --run ndn-test --command-template="%s --old-cs=ns3::ndn::cs::Lru --cs-size=${size} --rate=${rate} --pit=$(true) --open-name-tree=true --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
 size=100000
 rate=100
 sim_time=$(( 2000 / rate ))
@@ -52,3 +66,30 @@ echo
 echo "Using best route forwarding strategy.."
 
 ../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
+# hash index in front of NFD's CS, for comparison
+echo "Using best route forwarding strategy with CS hash index.."
+
+../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --cs-hash-index=true --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
+# Bloom filter Dead Nonce List, for comparison
+echo "Using best route forwarding strategy with Bloom filter Dead Nonce List.."
+
+../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --dnl-bloom=true --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
+size=1000
+rate=1000
+sim_time=$(( 2000 / rate ))
+
+# hit-heavy Zipf-Mandelbrot workload served from ndnSIM's CS
+echo "Using ndnSIM's CS with Zipf-Mandelbrot popularity.."
+
+echo "CS size = " $size, "interest rate = " $rate
+
+../../../waf --run ndn-test --command-template="%s --old-cs=ns3::ndn::cs::Lru --cs-size=${size} --rate=${rate} --zipf=${size} --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/core/pool-allocator.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::FixedSizePool;
+using nfd::PoolAllocator;
+
+BOOST_AUTO_TEST_SUITE(NfdCorePoolAllocator)
+
+BOOST_AUTO_TEST_CASE(FixedSizePoolReuse)
+{
+  FixedSizePool pool(4);
+  BOOST_CHECK_EQUAL(pool.getChunkSize(), 0);
+
+  void* a = pool.allocate(20);
+  BOOST_CHECK_EQUAL(pool.getChunkSize(), 32);
+  BOOST_CHECK_EQUAL(pool.getNReservedBytes(), 4 * 32);
+
+  std::vector<void*> chunks;
+  for (int i = 0; i < 5; ++i) {
+    chunks.push_back(pool.allocate(20));
+  }
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), 6);
+  BOOST_CHECK_EQUAL(pool.getNReservedBytes(), 2 * 4 * 32);
+
+  // a released chunk is handed out next
+  pool.deallocate(a, 20);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), 5);
+  BOOST_CHECK_EQUAL(pool.allocate(20), a);
+
+  // larger requests bypass the pool
+  void* large = pool.allocate(100);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), 6);
+  pool.deallocate(large, 100);
+
+  pool.deallocate(a, 20);
+  for (void* chunk : chunks) {
+    pool.deallocate(chunk, 20);
+  }
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), 0);
+  BOOST_CHECK_EQUAL(pool.getNReservedBytes(), 2 * 4 * 32);
+}
+
+struct PoolTestEntry
+{
+  explicit
+  PoolTestEntry(int value)
+    : value(value)
+  {
+  }
+
+  int value;
+  char payload[40];
+};
+
+BOOST_AUTO_TEST_CASE(AllocateShared)
+{
+  const FixedSizePool& pool = PoolAllocator<PoolTestEntry>::getPool();
+  size_t nAllocatedBefore = pool.getNAllocatedChunks();
+
+  std::vector<shared_ptr<PoolTestEntry>> entries;
+  for (int i = 0; i < 10; ++i) {
+    entries.push_back(std::allocate_shared<PoolTestEntry>(PoolAllocator<PoolTestEntry>(), i));
+  }
+  // the entry and its control block share one chunk
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 10);
+  BOOST_CHECK_GE(pool.getChunkSize(), sizeof(PoolTestEntry));
+  for (int i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(entries[i]->value, i);
+  }
+
+  std::weak_ptr<PoolTestEntry> weak = entries.front();
+  entries.erase(entries.begin());
+  // the chunk is held until the last weak_ptr is gone
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 9 + 1);
+  weak.reset();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 9);
+
+  entries.clear();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/core/scheduler.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+namespace scheduler = nfd::scheduler;
+
+class TimerTarget
+{
+public:
+  void
+  fire(int value)
+  {
+    m_values.push_back(value);
+  }
+
+public:
+  std::vector<int> m_values;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdCoreScheduler, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Timer)
+{
+  uint64_t nScheduledBefore = scheduler::getNScheduledEvents();
+  uint64_t nCancelledBefore = scheduler::getNCancelledEvents();
+
+  TimerTarget target;
+  scheduler::Timer timer;
+  BOOST_CHECK_EQUAL(timer.isPending(), false);
+
+  timer.schedule(::ndn::time::milliseconds(100), &TimerTarget::fire, &target, 1);
+  BOOST_CHECK_EQUAL(timer.isPending(), true);
+
+  Simulator::Stop(MilliSeconds(50));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(target.m_values.size(), 0);
+
+  // scheduling again replaces the pending event
+  timer.schedule(::ndn::time::milliseconds(100), &TimerTarget::fire, &target, 2);
+  Simulator::Stop(MilliSeconds(60));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(target.m_values.size(), 0);
+  BOOST_CHECK_EQUAL(timer.isPending(), true);
+
+  Simulator::Stop(MilliSeconds(50));
+  Simulator::Run();
+  BOOST_REQUIRE_EQUAL(target.m_values.size(), 1);
+  BOOST_CHECK_EQUAL(target.m_values[0], 2);
+  BOOST_CHECK_EQUAL(timer.isPending(), false);
+
+  BOOST_CHECK_EQUAL(scheduler::getNScheduledEvents() - nScheduledBefore, 2);
+  BOOST_CHECK_EQUAL(scheduler::getNCancelledEvents() - nCancelledBefore, 1);
+
+  // cancelling an expired event is not counted
+  timer.cancel();
+  BOOST_CHECK_EQUAL(scheduler::getNCancelledEvents() - nCancelledBefore, 1);
+
+  timer.schedule(::ndn::time::milliseconds(100), &TimerTarget::fire, &target, 3);
+  timer.cancel();
+  BOOST_CHECK_EQUAL(timer.isPending(), false);
+  Simulator::Stop(MilliSeconds(200));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(target.m_values.size(), 1);
+  BOOST_CHECK_EQUAL(scheduler::getNScheduledEvents() - nScheduledBefore, 3);
+  BOOST_CHECK_EQUAL(scheduler::getNCancelledEvents() - nCancelledBefore, 2);
+}
+
+BOOST_AUTO_TEST_CASE(TimerOutlivedByEvent)
+{
+  TimerTarget target;
+  {
+    scheduler::Timer timer;
+    timer.schedule(::ndn::time::milliseconds(100), &TimerTarget::fire, &target, 1);
+  }
+
+  // as with EventId, destroying the Timer does not cancel the event
+  Simulator::Stop(MilliSeconds(200));
+  Simulator::Run();
+  BOOST_REQUIRE_EQUAL(target.m_values.size(), 1);
+  BOOST_CHECK_EQUAL(target.m_values[0], 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
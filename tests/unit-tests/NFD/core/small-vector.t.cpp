@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/core/small-vector.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::SmallVector;
+
+/**
+ * @brief Element that counts live instances
+ */
+class Counted
+{
+public:
+  explicit
+  Counted(int value)
+    : m_value(value)
+  {
+    ++s_nInstances;
+  }
+
+  Counted(const Counted& other)
+    : m_value(other.m_value)
+  {
+    ++s_nInstances;
+  }
+
+  Counted&
+  operator=(const Counted& other) = default;
+
+  ~Counted()
+  {
+    --s_nInstances;
+  }
+
+  int
+  getValue() const
+  {
+    return m_value;
+  }
+
+public:
+  static int s_nInstances;
+
+private:
+  int m_value;
+};
+
+int Counted::s_nInstances = 0;
+
+static std::vector<int>
+getValues(const SmallVector<Counted, 2>& v)
+{
+  std::vector<int> values;
+  for (const Counted& c : v) {
+    values.push_back(c.getValue());
+  }
+  return values;
+}
+
+BOOST_AUTO_TEST_SUITE(NfdCoreSmallVector)
+
+BOOST_AUTO_TEST_CASE(InlineAndHeap)
+{
+  Counted::s_nInstances = 0;
+  {
+    SmallVector<Counted, 2> v;
+    BOOST_CHECK(v.empty());
+    BOOST_CHECK_EQUAL(v.capacity(), 2);
+
+    v.emplace_back(1);
+    v.emplace_back(2);
+    BOOST_CHECK_EQUAL(v.size(), 2);
+    BOOST_CHECK_EQUAL(v.capacity(), 2);
+    // inline storage is inside the container
+    BOOST_CHECK(reinterpret_cast<const char*>(&v.front()) >= reinterpret_cast<const char*>(&v));
+    BOOST_CHECK(reinterpret_cast<const char*>(&v.back()) < reinterpret_cast<const char*>(&v + 1));
+
+    v.emplace_back(3);
+    BOOST_CHECK_EQUAL(v.size(), 3);
+    BOOST_CHECK_EQUAL(v.capacity(), 4);
+    BOOST_CHECK(reinterpret_cast<const char*>(&v.front()) < reinterpret_cast<const char*>(&v) ||
+                reinterpret_cast<const char*>(&v.front()) >= reinterpret_cast<const char*>(&v + 1));
+
+    std::vector<int> expected{1, 2, 3};
+    std::vector<int> values = getValues(v);
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(Counted::s_nInstances, 3);
+  }
+  BOOST_CHECK_EQUAL(Counted::s_nInstances, 0);
+}
+
+BOOST_AUTO_TEST_CASE(EmplaceAndErase)
+{
+  Counted::s_nInstances = 0;
+  {
+    SmallVector<Counted, 2> v;
+    v.emplace_front(2);
+    v.emplace_front(1);
+    v.emplace(v.begin() + 1, 5);
+    v.emplace(v.end(), 4);
+    v.emplace(v.begin() + 3, 3);
+
+    std::vector<int> expected{1, 5, 2, 3, 4};
+    std::vector<int> values = getValues(v);
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(Counted::s_nInstances, 5);
+
+    auto it = v.erase(v.begin() + 1);
+    BOOST_CHECK_EQUAL(it->getValue(), 2);
+    it = v.erase(v.end() - 1);
+    BOOST_CHECK(it == v.end());
+    expected = {1, 2, 3};
+    values = getValues(v);
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(Counted::s_nInstances, 3);
+
+    v.clear();
+    BOOST_CHECK(v.empty());
+    BOOST_CHECK_EQUAL(Counted::s_nInstances, 0);
+
+    v.emplace_back(7);
+    BOOST_CHECK_EQUAL(v[0].getValue(), 7);
+  }
+  BOOST_CHECK_EQUAL(Counted::s_nInstances, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
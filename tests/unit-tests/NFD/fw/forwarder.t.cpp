@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/fw/forwarder.hpp"
+#include "NFD/daemon/fw/strategy.hpp"
+#include "model/cs/ndn-content-store.hpp"
+
+#include "ns3/object-factory.h"
+
+#include <ndn-cxx/ndn-congestion-tag.hpp>
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Strategy that marks the first CS hit it sees, as PconStrategy marks congested hits
+ */
+class MarkingStrategy : public nfd::fw::Strategy
+{
+public:
+  explicit
+  MarkingStrategy(nfd::Forwarder& forwarder)
+    : Strategy(forwarder, "ndn:/localhost/nfd/strategy/test-marking")
+    , m_nMarked(0)
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const nfd::Face& inFace, const Interest& interest,
+                       shared_ptr<nfd::fib::Entry> fibEntry,
+                       shared_ptr<nfd::pit::Entry> pitEntry)
+  {
+    this->rejectPendingInterest(pitEntry);
+  }
+
+  virtual void
+  beforeSatisfyInterestFromCs(shared_ptr<nfd::pit::Entry> pitEntry, const nfd::Face& inFace,
+                              const Data& data, nfd::CsHit& hit)
+  {
+    if (m_nMarked++ == 0) {
+      hit.congestionTag = make_shared< ::ndn::CongestionTag>(-1, 1, true, false);
+    }
+  }
+
+private:
+  int m_nMarked;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwForwarder, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(NdnSimCsHitsShareData)
+{
+  ObjectFactory factory("ns3::ndn::cs::Lru");
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+  shared_ptr<Data> data = makeData("/A/B");
+  data->setFreshnessPeriod(::ndn::time::seconds(10));
+  data->wireEncode();
+  BOOST_REQUIRE(cs->Add(data));
+
+  nfd::Forwarder forwarder;
+  forwarder.setCsFromNdnSim(cs);
+  shared_ptr<MarkingStrategy> strategy = make_shared<MarkingStrategy>(std::ref(forwarder));
+  forwarder.getStrategyChoice().install(strategy);
+  forwarder.getStrategyChoice().insert("/", strategy->getName());
+
+  shared_ptr<DummyNfdFace> face1 = make_shared<DummyNfdFace>();
+  shared_ptr<DummyNfdFace> face2 = make_shared<DummyNfdFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+
+  shared_ptr<Interest> interest1 = makeInterest("/A");
+  interest1->setNonce(1);
+  face1->receiveInterest(*interest1);
+  shared_ptr<Interest> interest2 = makeInterest("/A");
+  interest2->setNonce(2);
+  face2->receiveInterest(*interest2);
+
+  // both hits send the cached Data itself, only the first one is marked
+  shared_ptr<const Data> cached = cs->Lookup(interest1);
+  BOOST_REQUIRE(cached != nullptr);
+  BOOST_REQUIRE_EQUAL(face1->m_sentCachedData.size(), 1);
+  BOOST_REQUIRE_EQUAL(face2->m_sentCachedData.size(), 1);
+  BOOST_CHECK(face1->m_sentCachedData[0] == cached);
+  BOOST_CHECK(face2->m_sentCachedData[0] == cached);
+  BOOST_CHECK(face1->m_sentCsHits[0].congestionTag != nullptr);
+  BOOST_CHECK(face2->m_sentCsHits[0].congestionTag == nullptr);
+  BOOST_CHECK_EQUAL(face1->m_sentCsHits[0].incomingFaceId, nfd::FACEID_CONTENT_STORE);
+  BOOST_CHECK_EQUAL(face2->m_sentCsHits[0].incomingFaceId, nfd::FACEID_CONTENT_STORE);
+
+  // the cached Data carries neither
+  BOOST_CHECK(cached->getTag< ::ndn::CongestionTag>() == nullptr);
+  BOOST_CHECK(!cached->getLocalControlHeader().hasIncomingFaceId());
+  BOOST_CHECK(cached->wireEncode() == data->wireEncode());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/fw/mt-forwarding-info.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fw::MtForwardingInfo;
+
+BOOST_AUTO_TEST_SUITE(NfdFwMtForwardingInfo)
+
+BOOST_AUTO_TEST_CASE(SetAndGet)
+{
+  MtForwardingInfo info;
+  info.setforwPerc(3, 0.5);
+  info.setforwPerc(1, 0.3);
+  info.setforwPerc(2, 0.2);
+  info.increaseforwPerc(2, 0.1);
+
+  BOOST_REQUIRE_EQUAL(info.size(), 3);
+  BOOST_CHECK_EQUAL(info.getFaceCount(), 3);
+  BOOST_CHECK_EQUAL(info.findIndex(3), 0);
+  BOOST_CHECK_EQUAL(info.findIndex(1), 1);
+  BOOST_CHECK_EQUAL(info.findIndex(2), 2);
+  BOOST_CHECK_EQUAL(info.findIndex(2, 2), 2);
+  BOOST_CHECK_EQUAL(info.findIndex(2, 0), 2);
+  BOOST_CHECK_EQUAL(info.findIndex(2, 7), 2);
+  BOOST_CHECK_EQUAL(info.getFaceIdAt(1), 1);
+  BOOST_CHECK_CLOSE(info.getforwPerc(3), 0.5, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(2), 0.3, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPercAt(1), 0.3, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE(MissingFace)
+{
+  MtForwardingInfo info;
+  BOOST_CHECK_EQUAL(info.findIndex(7), 0);
+  BOOST_CHECK_EQUAL(info.getforwPerc(7), 0.0);
+
+  info.setforwPerc(1, 0.6);
+  info.setforwPerc(2, 0.4);
+  BOOST_CHECK_EQUAL(info.findIndex(7), info.size());
+  BOOST_CHECK_EQUAL(info.findIndex(7, 1), info.size());
+  BOOST_CHECK_EQUAL(info.getforwPerc(7), 0.0);
+
+  // reducing a face that is not in the table changes nothing
+  BOOST_CHECK_CLOSE(info.reduceforwPerc(7, 0.1), 1.0, 0.0001);
+  BOOST_CHECK_EQUAL(info.size(), 2);
+  BOOST_CHECK_CLOSE(info.getforwPerc(1), 0.6, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(2), 0.4, 0.0001);
+
+  BOOST_CHECK_EQUAL(info.addFace(7), true);
+  BOOST_CHECK_EQUAL(info.addFace(7), false);
+  BOOST_CHECK_EQUAL(info.addFace(1), false);
+  BOOST_REQUIRE_EQUAL(info.size(), 3);
+  BOOST_CHECK_EQUAL(info.findIndex(7), 2);
+  BOOST_CHECK_EQUAL(info.getforwPerc(7), 0.0);
+  BOOST_CHECK_CLOSE(info.getforwPerc(1), 0.6, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE(ReduceforwPerc)
+{
+  MtForwardingInfo info;
+  info.setforwPerc(1, 0.6);
+  info.setforwPerc(2, 0.3);
+  info.setforwPerc(3, 0.1);
+
+  BOOST_CHECK_CLOSE(info.reduceforwPerc(1, 0.2), 1.0, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(1), 0.4, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(2), 0.4, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(3), 0.2, 0.0001);
+
+  // capped at the current percentage
+  BOOST_CHECK_CLOSE(info.reduceforwPerc(3, 0.5), 1.0, 0.0001);
+  BOOST_CHECK_EQUAL(info.getforwPerc(3), 0.0);
+  BOOST_CHECK_CLOSE(info.getforwPerc(1), 0.5, 0.0001);
+  BOOST_CHECK_CLOSE(info.getforwPerc(2), 0.5, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE(SelectIndex)
+{
+  MtForwardingInfo info;
+  info.setforwPerc(1, 0.5);
+  info.setforwPerc(2, 0.3);
+  info.setforwPerc(3, 0.2);
+
+  BOOST_CHECK_EQUAL(info.selectIndex(0.0), 0);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.49), 0);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.51), 1);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.79), 1);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.81), 2);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.9999), 2);
+
+  // the cumulative distribution is rebuilt after a change
+  info.setforwPerc(1, 0.0);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.0), 1);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.59), 1);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.61), 2);
+
+  // restricted to candidates 0 and 2 (sum 0.2)
+  std::vector<size_t> candidates{0, 2};
+  BOOST_CHECK_EQUAL(info.selectIndex(0.0, candidates, 0.2), 2);
+  BOOST_CHECK_EQUAL(info.selectIndex(0.9999, candidates, 0.2), 2);
+}
+
+BOOST_AUTO_TEST_CASE(SampleIndex)
+{
+  MtForwardingInfo info;
+  info.setforwPerc(1, 0.5);
+  info.setforwPerc(2, 0.3);
+  info.setforwPerc(3, 0.2);
+
+  // sampling over a fine grid of r reproduces the percentages of the eligible faces
+  const size_t nSamples = 10000;
+  std::vector<size_t> counts(info.size());
+  for (size_t i = 0; i < nSamples; ++i) {
+    ++counts[info.sampleIndex((i + 0.5) / nSamples, 0x7)];
+  }
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[0]) / nSamples, 0.5, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[1]) / nSamples, 0.3, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[2]) / nSamples, 0.2, 1);
+
+  // face at index 0 (e.g., the downstream) is not eligible
+  std::fill(counts.begin(), counts.end(), 0);
+  for (size_t i = 0; i < nSamples; ++i) {
+    ++counts[info.sampleIndex((i + 0.5) / nSamples, 0x6)];
+  }
+  BOOST_CHECK_EQUAL(counts[0], 0);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[1]) / nSamples, 0.6, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[2]) / nSamples, 0.4, 1);
+
+  // cached tables are dropped after a change
+  info.setforwPerc(3, 0.0);
+  for (size_t i = 0; i < nSamples; ++i) {
+    BOOST_CHECK_EQUAL(info.sampleIndex((i + 0.5) / nSamples, 0x6), 1);
+  }
+
+  // an eligible set without any share is split equally
+  info.setforwPerc(1, 0.0);
+  std::fill(counts.begin(), counts.end(), 0);
+  for (size_t i = 0; i < nSamples; ++i) {
+    ++counts[info.sampleIndex((i + 0.5) / nSamples, 0x5)];
+  }
+  BOOST_CHECK_EQUAL(counts[1], 0);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[0]) / nSamples, 0.5, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(counts[2]) / nSamples, 0.5, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TESTS_UNIT_TESTS_NFD_NFD_TESTS_COMMON_HPP
+#define NDNSIM_TESTS_UNIT_TESTS_NFD_NFD_TESTS_COMMON_HPP
+
+#include "model/ndn-common.hpp"
+#include "utils/ndn-time.hpp"
+
+#include "NFD/daemon/face/face.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Fixture for tests of NFD tables without a simulated network
+ *
+ * NFD takes its time from ndn-cxx clocks and its timers from the ns-3 Simulator; this fixture
+ * makes the clocks follow simulation time (as StackHelper does), so that tables can be aged with
+ * Simulator::Stop and Simulator::Run.
+ */
+class NfdTableFixture : public CleanupFixture
+{
+public:
+  NfdTableFixture()
+  {
+    ::ndn::time::setCustomClocks(make_shared<time::CustomSteadyClock>(),
+                                 make_shared<time::CustomSystemClock>());
+  }
+
+  void
+  advanceTime(const Time& duration)
+  {
+    Simulator::Stop(duration);
+    Simulator::Run();
+  }
+};
+
+/**
+ * @brief Face that records what is sent on it, and on which packets can be received
+ */
+class DummyNfdFace : public nfd::Face
+{
+public:
+  DummyNfdFace()
+    : Face(::ndn::util::FaceUri("dummy://"), ::ndn::util::FaceUri("dummy://"))
+  {
+  }
+
+  virtual void
+  sendInterest(const Interest& interest)
+  {
+    m_sentInterests.push_back(interest);
+  }
+
+  virtual void
+  sendData(const Data& data)
+  {
+    m_sentData.push_back(data);
+  }
+
+  virtual void
+  sendCachedData(const Data& data, const nfd::CsHit& hit)
+  {
+    m_sentCachedData.push_back(data.shared_from_this());
+    m_sentCsHits.push_back(hit);
+  }
+
+  virtual void
+  close()
+  {
+    this->fail("close");
+  }
+
+  void
+  receiveInterest(const Interest& interest)
+  {
+    this->emitSignal(onReceiveInterest, interest);
+  }
+
+public:
+  std::vector<Interest> m_sentInterests;
+  std::vector<Data> m_sentData;
+  std::vector<shared_ptr<const Data>> m_sentCachedData;
+  std::vector<nfd::CsHit> m_sentCsHits;
+};
+
+inline shared_ptr<Interest>
+makeInterest(const Name& name)
+{
+  return make_shared<Interest>(name);
+}
+
+/**
+ * @brief Creates a Data packet with a fake signature, as Producer does
+ */
+inline shared_ptr<Data>
+makeData(const Name& name)
+{
+  shared_ptr<Data> data = make_shared<Data>(name);
+
+  Signature signature;
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+  signature.setInfo(signatureInfo);
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+  data->setSignature(signature);
+  data->wireEncode();
+
+  return data;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_TESTS_UNIT_TESTS_NFD_NFD_TESTS_COMMON_HPP
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/cs.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::cs::Cs;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableCs, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(HashIndex)
+{
+  Cs cs(3, nfd::cs::makeDefaultPolicy(), true);
+  BOOST_CHECK(cs.hasHashIndex());
+
+  Name found;
+  auto find = [&] (const Interest& interest) {
+    found = "/MISS";
+    cs.find(interest,
+            [&] (const Interest&, const Data& data) { found = data.getName(); },
+            [] (const Interest&) {});
+  };
+
+  cs.insert(*makeData("/A/B"));
+  cs.insert(*makeData("/A/C"));
+
+  find(Interest("/A/B"));
+  BOOST_CHECK_EQUAL(found, "/A/B");
+  find(Interest("/A"));
+  BOOST_CHECK_EQUAL(found, "/A/B");
+  find(Interest("/A").setChildSelector(1));
+  BOOST_CHECK_EQUAL(found, "/A/C");
+  find(Interest("/A/B").setMinSuffixComponents(2));
+  BOOST_CHECK_EQUAL(found, "/MISS");
+  find(Interest("/B/A"));
+  BOOST_CHECK_EQUAL(found, "/MISS");
+
+  // evicts /A/B
+  cs.insert(*makeData("/D"));
+  cs.insert(*makeData("/E"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  find(Interest("/A/B"));
+  BOOST_CHECK_EQUAL(found, "/MISS");
+  find(Interest("/A"));
+  BOOST_CHECK_EQUAL(found, "/A/C");
+  find(Interest("/E"));
+  BOOST_CHECK_EQUAL(found, "/E");
+}
+
+BOOST_AUTO_TEST_CASE(EntryDecodesData)
+{
+  Cs cs;
+
+  shared_ptr<Data> data = makeData("/A/B");
+  data->setFreshnessPeriod(::ndn::time::seconds(10));
+  data->wireEncode();
+  cs.insert(*data);
+
+  const nfd::cs::Entry& entry = *cs.begin();
+  BOOST_CHECK_EQUAL(entry.getName(), data->getName());
+  BOOST_CHECK_EQUAL(entry.getFullName(), data->getFullName());
+  // the digest is computed once
+  BOOST_CHECK_EQUAL(&entry.getFullName(), &entry.getFullName());
+  BOOST_CHECK(entry.getFreshnessPeriod() == ::ndn::time::seconds(10));
+
+  shared_ptr<const Data> decoded = entry.getData();
+  BOOST_CHECK(decoded != data);
+  BOOST_CHECK(decoded->wireEncode() == data->wireEncode());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/dead-nonce-list.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::DeadNonceList;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableDeadNonceList, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(PrecomputedNameHash)
+{
+  const uint32_t nonce1 = 0x53b4eaa8;
+  const uint32_t nonce2 = 0x1f46372b;
+  shared_ptr<Interest> interestAB = makeInterest("/A/B");
+  interestAB->setNonce(nonce1);
+  shared_ptr<Interest> interestBA = makeInterest("/B/A");
+  interestBA->setNonce(nonce1);
+
+  DeadNonceList dnl;
+  dnl.add(*interestAB, nonce2);
+  BOOST_CHECK_EQUAL(dnl.has(Name("/A/B"), nonce2), true);
+  BOOST_CHECK_EQUAL(dnl.has(*interestAB), false);
+
+  dnl.add(Name("/A/B"), nonce1);
+  BOOST_CHECK_EQUAL(dnl.has(*interestAB), true);
+  BOOST_CHECK_EQUAL(dnl.has(*interestBA), false);
+
+  // the hash cached on the Interest must not outlive a change of its Name
+  interestAB->setName("/B/A");
+  BOOST_CHECK_EQUAL(dnl.has(*interestAB), false);
+}
+
+BOOST_AUTO_TEST_CASE(BloomFilter)
+{
+  const ::ndn::time::nanoseconds lifetime = ::ndn::time::seconds(3);
+  DeadNonceList::BloomFilterOptions options;
+  options.isEnabled = true;
+  options.nExpectedEntries = 3000;
+  options.falsePositiveRate = 0.01;
+  options.shouldCountFalsePositives = true;
+  DeadNonceList dnl(lifetime, options);
+  BOOST_CHECK_EQUAL(dnl.hasBloomFilter(), true);
+
+  for (uint32_t nonce = 0; nonce < 1000; ++nonce) {
+    dnl.add(Name("/A"), nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.size(), 1000);
+
+  size_t nFound = 0;
+  for (uint32_t nonce = 0; nonce < 1000; ++nonce) {
+    nFound += dnl.has(Name("/A"), nonce);
+  }
+  BOOST_CHECK_EQUAL(nFound, 1000); // no false negatives
+  BOOST_CHECK_EQUAL(dnl.getNFalsePositives(), 0);
+
+  size_t nFalsePositives = 0;
+  for (uint32_t nonce = 0; nonce < 100000; ++nonce) {
+    nFalsePositives += dnl.has(Name("/B"), nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.getNFalsePositives(), nFalsePositives);
+  BOOST_CHECK_LT(nFalsePositives, 100000 * options.falsePositiveRate * 2);
+
+  // the slice holding these Nonces is cleared on the fourth rotation, one rotation interval
+  // (a third of the lifetime) is 1s
+  advanceTime(Seconds(2.9));
+  BOOST_CHECK_EQUAL(dnl.has(Name("/A"), 1), true);
+  advanceTime(Seconds(1.2));
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(Name("/A"), 1), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/fib.hpp"
+#include "NFD/daemon/table/pit.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::NameTree;
+using nfd::Fib;
+using nfd::Pit;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableFib, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchPitEntryCache)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+  fib.insert("/");
+  fib.insert("/A");
+
+  shared_ptr<nfd::pit::Entry> pitEntry = pit.insert(*makeInterest("/A/B/C/D")).first;
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/A");
+
+  // inserting and erasing entries invalidates the cached match
+  fib.insert("/A/B/C");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/A/B/C");
+
+  fib.erase("/A/B/C");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/A");
+
+  fib.erase("/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/");
+
+  fib.erase("/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->hasNextHops(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
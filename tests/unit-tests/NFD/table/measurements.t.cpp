@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/measurements.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::NameTree;
+using nfd::Measurements;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableMeasurements, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  const Time initialLifetime = NanoSeconds(Measurements::getInitialLifetime().count());
+
+  shared_ptr<nfd::measurements::Entry> entryA = measurements.get("/A");
+  measurements.get("/B");
+  BOOST_CHECK_EQUAL(measurements.size(), 2);
+
+  advanceTime(Seconds(1));
+  measurements.extendLifetime(*entryA, Measurements::getInitialLifetime());
+  // a shorter lifetime does not shorten it
+  measurements.extendLifetime(*entryA, ::ndn::time::seconds(1));
+  entryA.reset();
+
+  advanceTime(initialLifetime - Seconds(0.5));
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+  BOOST_CHECK(measurements.findExactMatch("/A") != nullptr);
+
+  advanceTime(Seconds(1));
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+  BOOST_CHECK_EQUAL(nameTree.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/name-tree.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::NameTree;
+namespace name_tree = nfd::name_tree;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableNameTree, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(IncrementalHash)
+{
+  Name prefix("/nohello/world/ndn/research");
+  std::vector<size_t> hashSet = name_tree::computeHashSet(prefix);
+  BOOST_REQUIRE_EQUAL(hashSet.size(), prefix.size() + 1);
+  BOOST_CHECK_EQUAL(hashSet[0], 0);
+  for (size_t i = 0; i <= prefix.size(); ++i) {
+    BOOST_CHECK_EQUAL(hashSet[i], name_tree::computeHash(prefix.getPrefix(i)));
+  }
+
+  // entries created along the way carry the hash of their own prefix
+  NameTree nameTree;
+  shared_ptr<name_tree::Entry> entry = nameTree.lookup(prefix);
+  BOOST_CHECK_EQUAL(nameTree.size(), prefix.size() + 1);
+  for (size_t i = prefix.size() + 1; i > 0; --i) {
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_CHECK_EQUAL(entry->getPrefix(), prefix.getPrefix(i - 1));
+    BOOST_CHECK_EQUAL(entry->getHash(), hashSet[i - 1]);
+    entry = entry->getParent();
+  }
+  BOOST_CHECK(entry == nullptr);
+
+  // a lookup that reuses existing entries finds the same ones
+  shared_ptr<name_tree::Entry> sibling = nameTree.lookup("/nohello/world/ndn/other");
+  BOOST_CHECK_EQUAL(nameTree.size(), prefix.size() + 2);
+  BOOST_CHECK_EQUAL(sibling->getHash(), name_tree::computeHash("/nohello/world/ndn/other"));
+  BOOST_CHECK_EQUAL(sibling->getParent(), nameTree.findExactMatch("/nohello/world/ndn"));
+  BOOST_CHECK_EQUAL(nameTree.findLongestPrefixMatch("/nohello/world/ndn/other/x"), sibling);
+}
+
+BOOST_AUTO_TEST_CASE(OpenAddressingResize)
+{
+  NameTree nameTree(16, name_tree::STORAGE_OPEN_ADDRESSING);
+  BOOST_CHECK_EQUAL(nameTree.getStorageType(), name_tree::STORAGE_OPEN_ADDRESSING);
+  size_t nSlots = nameTree.getNBuckets();
+
+  // enough entries for several incremental resizes
+  std::vector<shared_ptr<name_tree::Entry>> leaves;
+  for (int i = 0; i < 1000; ++i) {
+    leaves.push_back(nameTree.lookup(Name("/a").appendNumber(i % 10).appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(nameTree.size(), 1012);
+  BOOST_CHECK_GT(nameTree.getNBuckets(), nSlots);
+
+  for (int i = 0; i < 1000; ++i) {
+    Name name = Name("/a").appendNumber(i % 10).appendNumber(i);
+    BOOST_CHECK_EQUAL(nameTree.findExactMatch(name), leaves[i]);
+    BOOST_CHECK_EQUAL(nameTree.findLongestPrefixMatch(Name(name).append("x")), leaves[i]);
+    BOOST_CHECK_EQUAL(nameTree.lookup(name), leaves[i]);
+  }
+  BOOST_CHECK_EQUAL(nameTree.size(), 1012);
+
+  std::set<Name> seenNames;
+  for (const name_tree::Entry& entry : nameTree) {
+    BOOST_CHECK(seenNames.insert(entry.getPrefix()).second);
+  }
+  BOOST_CHECK_EQUAL(seenNames.size(), 1012);
+
+  for (shared_ptr<name_tree::Entry>& leaf : leaves) {
+    shared_ptr<name_tree::Entry> entry = leaf;
+    leaf.reset();
+    nameTree.eraseEntryIfEmpty(entry);
+  }
+  BOOST_CHECK_EQUAL(nameTree.size(), 0);
+  BOOST_CHECK(nameTree.findExactMatch("/a") == nullptr);
+  BOOST_CHECK_EQUAL(nameTree.getNBuckets(), nSlots);
+}
+
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name prefix("/nohello/world/ndn/research");
+  std::vector<size_t> hashSet = name_tree::computeHashSet(prefix);
+  BOOST_CHECK_EQUAL(hashSet[2], name_tree::computeHash("/nohello/world"));
+  BOOST_CHECK_EQUAL(hashSet.back(), name_tree::computeHash(prefix));
+
+  // the hash depends on the order of components
+  BOOST_CHECK_NE(name_tree::computeHash("/world/nohello"), hashSet[2]);
+  BOOST_CHECK_NE(name_tree::computeHash("/A/A"), name_tree::computeHash("/"));
+}
+
+BOOST_AUTO_TEST_CASE(PacketHashSet)
+{
+  shared_ptr<Interest> interest = makeInterest("/A/B/C");
+  const std::vector<size_t>& hashSet = name_tree::getHashSet(*interest);
+  BOOST_CHECK(hashSet == name_tree::computeHashSet(interest->getName()));
+  // cached on the packet
+  BOOST_CHECK_EQUAL(&name_tree::getHashSet(*interest), &hashSet);
+
+  NameTree nameTree;
+  shared_ptr<name_tree::Entry> entry = nameTree.lookup(interest->getName(), hashSet);
+  BOOST_CHECK_EQUAL(entry, nameTree.findExactMatch("/A/B/C"));
+  BOOST_CHECK_EQUAL(nameTree.findLongestPrefixMatch(interest->getName(), hashSet), entry);
+
+  // recomputed after the Name changes
+  interest->setName("/A/B");
+  BOOST_CHECK_EQUAL(name_tree::getHashSet(*interest).size(), 3);
+  BOOST_CHECK_EQUAL(nameTree.findLongestPrefixMatch(interest->getName(),
+                                                    name_tree::getHashSet(*interest)),
+                    entry->getParent());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/pit.hpp"
+
+#include "../nfd-tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::NameTree;
+using nfd::Pit;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTablePit, NfdTableFixture)
+
+BOOST_AUTO_TEST_CASE(EntryPooling)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  const nfd::FixedSizePool& pool = Pit::getEntryPool();
+  size_t nAllocatedBefore = pool.getNAllocatedChunks();
+
+  std::vector<shared_ptr<nfd::pit::Entry>> entries;
+  for (int i = 0; i < 3; ++i) {
+    entries.push_back(pit.insert(*makeInterest(Name("/A").appendNumber(i))).first);
+  }
+  BOOST_CHECK_EQUAL(pit.size(), 3);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 3);
+  BOOST_CHECK_GE(pool.getChunkSize(), sizeof(nfd::pit::Entry));
+
+  // an existing entry is found, not allocated
+  BOOST_CHECK(!pit.insert(*makeInterest(Name("/A").appendNumber(1))).second);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 3);
+
+  // the chunk is released with the last reference
+  pit.erase(entries.back());
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 3);
+  entries.pop_back();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 2);
+
+  Pit::setEntryPooling(false);
+  shared_ptr<nfd::pit::Entry> unpooled = pit.insert(*makeInterest("/B")).first;
+  Pit::setEntryPooling(true);
+  BOOST_CHECK_EQUAL(pit.size(), 3);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore + 2);
+  BOOST_CHECK_EQUAL(unpooled->getName(), "/B");
+
+  for (const shared_ptr<nfd::pit::Entry>& entry : entries) {
+    pit.erase(entry);
+  }
+  pit.erase(unpooled);
+  entries.clear();
+  BOOST_CHECK_EQUAL(pit.size(), 0);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedChunks(), nAllocatedBefore);
+}
+
+BOOST_AUTO_TEST_CASE(InlineRecords)
+{
+  shared_ptr<Interest> interest = makeInterest("/A");
+  interest->setNonce(1);
+  nfd::pit::Entry entry(*interest);
+
+  std::vector<shared_ptr<DummyNfdFace>> faces;
+  for (int i = 0; i < 4; ++i) {
+    faces.push_back(make_shared<DummyNfdFace>());
+  }
+
+  // two records are stored inside the entry, more spill to the heap
+  for (const shared_ptr<DummyNfdFace>& face : faces) {
+    entry.insertOrUpdateInRecord(face, *interest);
+    entry.insertOrUpdateOutRecord(face, *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), 4);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), 4);
+
+  // updating a record does not add one
+  interest->setNonce(2);
+  auto inRecord = entry.insertOrUpdateInRecord(faces[2], *interest);
+  BOOST_CHECK_EQUAL(inRecord->getLastNonce(), 2);
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), 4);
+
+  for (const shared_ptr<DummyNfdFace>& face : faces) {
+    BOOST_REQUIRE(entry.getInRecord(*face) != entry.getInRecords().end());
+    BOOST_CHECK_EQUAL(entry.getInRecord(*face)->getFace(), face);
+    BOOST_CHECK_EQUAL(entry.getInRecord(*face)->getLastNonce(), face == faces[2] ? 2 : 1);
+  }
+
+  // deleting a record keeps the others
+  entry.deleteOutRecord(*faces[1]);
+  entry.deleteOutRecord(*faces[3]);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), 2);
+  BOOST_CHECK(entry.getOutRecord(*faces[1]) == entry.getOutRecords().end());
+  BOOST_CHECK(entry.getOutRecord(*faces[3]) == entry.getOutRecords().end());
+  BOOST_CHECK_EQUAL(entry.getOutRecord(*faces[0])->getFace(), faces[0]);
+  BOOST_CHECK_EQUAL(entry.getOutRecord(*faces[2])->getFace(), faces[2]);
+
+  entry.deleteInRecords();
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), 0);
+  BOOST_CHECK(entry.getInRecord(*faces[0]) == entry.getInRecords().end());
+
+  // deleted records no longer hold their face
+  std::weak_ptr<DummyNfdFace> face1 = faces[1];
+  faces[1].reset();
+  BOOST_CHECK(face1.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -18,6 +18,8 @@
  **/
 
 #include "helper/ndn-fib-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "daemon/fw/forwarder.hpp"
 
 #include "../tests-common.hpp"
 
@@ -97,6 +99,28 @@ BOOST_AUTO_TEST_CASE(Helper4)
   FibHelper::AddRoute(getNode("1"), Name("/prefix"), getNode("2"), 10);
 }
 
+// static void
+// AddRoutes(Ptr<Node> node, const std::vector<Route>& routes);
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  FibHelper::ResetInstallStats();
+  FibHelper::AddRoutes(getNode("1"), {FibHelper::Route("/prefix", getFace("1", "2"), 1),
+                                      FibHelper::Route("/other", getFace("1", "2"), 7)});
+  BOOST_CHECK_EQUAL(FibHelper::GetInstallStats().nRoutes, 2);
+  BOOST_CHECK_GE(FibHelper::GetInstallStats().seconds, 0);
+
+  nfd::Fib& fib = getNode("1")->GetObject<L3Protocol>()->getForwarder()->getFib();
+  shared_ptr<nfd::fib::Entry> entry = fib.findExactMatch("/other");
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+  BOOST_CHECK(entry->getNextHops().front().getFace() == getFace("1", "2"));
+  BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 7);
+
+  // a command adds to the same statistics
+  FibHelper::AddRoute(getNode("1"), Name("/command"), getFace("1", "2"), 1);
+  BOOST_CHECK_EQUAL(FibHelper::GetInstallStats().nRoutes, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // AddRoute
 
 BOOST_AUTO_TEST_SUITE_END() // HelperNdnFibHelper
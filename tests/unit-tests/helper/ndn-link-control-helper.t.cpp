@@ -18,6 +18,9 @@
  **/
 
 #include "helper/ndn-link-control-helper.hpp"
+#include "helper/ndn-global-routing-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
 #include "NFD/core/scheduler.hpp"
 
 #include "../tests-common.hpp"
@@ -148,6 +151,60 @@ BOOST_AUTO_TEST_CASE(SixNodeTopology) // Bug #2783
   Simulator::Run();
 }
 
+BOOST_AUTO_TEST_CASE(IncrementalRouteUpdate)
+{
+  createTopology({
+      {"0", "1"},
+      {"1", "2"}, {"1", "3"},
+      {"2", "4"}, {"3", "4"},
+      {"4", "5"},
+    });
+  getFace("1", "3")->setMetric(5);
+
+  GlobalRoutingHelper::SetIncrementalUpdates(true);
+  GlobalRoutingHelper routingHelper;
+  routingHelper.InstallAll();
+  routingHelper.AddOrigin("/prefix", getNode("5"));
+  GlobalRoutingHelper::CalculateRoutes();
+  GlobalRoutingHelper::SetIncrementalUpdates(false);
+
+  auto getNextHop = [this] (const std::string& node) {
+    auto entry = getNode(node)->GetObject<L3Protocol>()->getForwarder()->getFib()
+                   .findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+    return entry->getNextHops().front();
+  };
+
+  BOOST_CHECK_EQUAL(getNextHop("1").getFace(), getFace("1", "2"));
+  BOOST_CHECK_EQUAL(getNextHop("1").getCost(), 3);
+  BOOST_CHECK_EQUAL(getNextHop("0").getCost(), 4);
+
+  LinkControlHelper::FailLink(getNode("1"), getNode("2"));
+
+  const GlobalRoutingHelper::UpdateStats& stats = GlobalRoutingHelper::GetLastUpdateStats();
+  BOOST_CHECK_EQUAL(stats.nTrees, 6);
+  BOOST_CHECK_GT(stats.nRecomputedTrees, 0);
+  BOOST_CHECK_GT(stats.nRemovedRoutes, 0);
+
+  BOOST_CHECK_EQUAL(getNextHop("1").getFace(), getFace("1", "3"));
+  BOOST_CHECK_EQUAL(getNextHop("1").getCost(), 7);
+  BOOST_CHECK_EQUAL(getNextHop("0").getFace(), getFace("0", "1"));
+  BOOST_CHECK_EQUAL(getNextHop("0").getCost(), 8);
+  BOOST_CHECK_EQUAL(getNextHop("2").getFace(), getFace("2", "4"));
+
+  LinkControlHelper::UpLink(getNode("1"), getNode("2"));
+
+  BOOST_CHECK_EQUAL(getNextHop("1").getFace(), getFace("1", "2"));
+  BOOST_CHECK_EQUAL(getNextHop("1").getCost(), 3);
+  BOOST_CHECK_EQUAL(getNextHop("0").getCost(), 4);
+
+  // without incremental updates, routes stay as calculated
+  GlobalRoutingHelper::CalculateRoutes();
+  LinkControlHelper::FailLink(getNode("1"), getNode("2"));
+  BOOST_CHECK_EQUAL(getNextHop("1").getFace(), getFace("1", "2"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
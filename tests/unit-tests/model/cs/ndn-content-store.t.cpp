@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/ndn-content-store.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/object-factory.h"
+
+#include <ndn-cxx/interest.hpp>
+#include <ndn-cxx/data.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelCsNdnContentStore, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(HitsShareData)
+{
+  ObjectFactory factory("ns3::ndn::cs::Lru");
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  auto data = make_shared<Data>("/prefix/data");
+  data->setFreshnessPeriod(time::milliseconds(1000));
+  data->setContent(make_shared< ::ndn::Buffer>(1024));
+  StackHelper::getKeyChain().sign(*data);
+  BOOST_CHECK(cs->Add(data));
+
+  auto interest = make_shared<Interest>("/prefix");
+  shared_ptr<const Data> hit1 = cs->Lookup(interest);
+  shared_ptr<const Data> hit2 = cs->Lookup(interest);
+  BOOST_REQUIRE(hit1 != nullptr);
+  BOOST_CHECK_EQUAL(*hit1, *data);
+
+  // the entry decodes its wire encoding on the first hit, and later hits share that Data
+  BOOST_CHECK_EQUAL(hit1, hit2);
+  BOOST_CHECK(hit1 != data);
+
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/other")) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
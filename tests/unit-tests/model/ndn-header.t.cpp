@@ -47,6 +47,47 @@ BOOST_AUTO_TEST_CASE(TypeId)
  BOOST_CHECK_EQUAL(dataPktHeader.GetSerializedSize(), 1354); // 328 + 1024
 }
 
+BOOST_AUTO_TEST_CASE(Deserialize)
+{
+  auto data = make_shared<ndn::Data>("/prefix/data");
+  data->setFreshnessPeriod(ndn::time::milliseconds(1000));
+  data->setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(*data);
+
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddHeader(PacketHeader<Data>(*data));
+
+  PacketHeader<Data> dataPktHeader;
+  BOOST_CHECK_EQUAL(packet->RemoveHeader(dataPktHeader), data->wireEncode().size());
+  BOOST_CHECK_EQUAL(packet->GetSize(), 0);
+  BOOST_CHECK_EQUAL(*dataPktHeader.getPacket(), *data);
+
+  auto interest = make_shared<ndn::Interest>("/prefix/interest");
+  interest->setNonce(42);
+  packet->AddHeader(PacketHeader<Interest>(*interest));
+
+  PacketHeader<Interest> interestPktHeader;
+  BOOST_CHECK_EQUAL(packet->RemoveHeader(interestPktHeader), interest->wireEncode().size());
+  BOOST_CHECK_EQUAL(*interestPktHeader.getPacket(), *interest);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeTruncated)
+{
+  // TLV-TYPE of Data, then a 2-octet TLV-LENGTH cut after its first octet
+  const uint8_t truncatedLength[] = {0x06, 0xFD, 0x04};
+  // 4-octet TLV-TYPE cut after two octets
+  const uint8_t truncatedType[] = {0xFE, 0x00, 0x00};
+
+  for (const auto& wire : {truncatedLength, truncatedType}) {
+    ns3::Buffer buffer;
+    buffer.AddAtStart(3);
+    buffer.Begin().Write(wire, 3);
+
+    PacketHeader<Data> dataPktHeader;
+    BOOST_CHECK_THROW(dataPktHeader.Deserialize(buffer.Begin()), ::ndn::tlv::Error);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
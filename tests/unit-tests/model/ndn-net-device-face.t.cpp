@@ -20,6 +20,10 @@
 
 #include "model/ndn-net-device-face.hpp"
 
+#include "ns3/point-to-point-net-device.h"
+#include "ns3/drop-tail-queue.h"
+#include "../../../../internet/model/codel-queue2.h"
+
 #include "../tests-common.hpp"
 
 namespace ns3 {
@@ -60,6 +64,40 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(getFace("2", "1")->getFaceStatus().getNOutDatas(), 100);
 }
 
+BOOST_AUTO_TEST_CASE(QueueInstalledAfterFace)
+{
+  createTopology({
+      {"1", "2"},
+    });
+
+  shared_ptr<NetDeviceFace> face = std::dynamic_pointer_cast<NetDeviceFace>(getFace("1", "2"));
+  BOOST_REQUIRE(face != nullptr);
+  Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>(face->GetNetDevice());
+  BOOST_REQUIRE(device != nullptr);
+
+  // default DropTailQueue
+  BOOST_CHECK_EQUAL(face->isCongested(), false);
+  BOOST_CHECK_EQUAL(face->isHighlyCongested(), false);
+
+  // queue replaced after the face was created (as SimHelper::setNodeQueue does)
+  Ptr<Queue> codel = CreateObject<CoDelQueue2>();
+  codel->SetAttribute("Mode", EnumValue(0));
+  codel->SetAttribute("MaxPackets", UintegerValue(10));
+  device->SetQueue(codel);
+
+  BOOST_CHECK_EQUAL(face->isCongested(), false);
+  BOOST_CHECK_EQUAL(face->isHighlyCongested(), false);
+
+  for (int i = 0; i < 10; ++i) {
+    BOOST_CHECK(codel->Enqueue(Create<Packet>(100)));
+  }
+  BOOST_CHECK_EQUAL(face->isHighlyCongested(), true);
+
+  Ptr<Queue> fifo = CreateObject<DropTailQueue>();
+  device->SetQueue(fifo);
+  BOOST_CHECK_EQUAL(face->isHighlyCongested(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
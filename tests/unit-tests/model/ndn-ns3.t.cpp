@@ -21,6 +21,7 @@
 #include "helper/ndn-stack-helper.hpp"
 #include "model/ndn-header.hpp"
 #include "utils/ndn-ns3-packet-tag.hpp"
+#include "utils/ndn-ns3-cc-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
@@ -54,6 +55,46 @@ BOOST_AUTO_TEST_CASE(ToPacket)
   BOOST_CHECK_EQUAL(type2, ::ndn::tlv::Data);
 }
 
+BOOST_AUTO_TEST_CASE(ForwardReceivedData)
+{
+  auto data = std::make_shared<ndn::Data>("/prefix/data");
+  data->setFreshnessPeriod(ndn::time::milliseconds(1000));
+  data->setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(*data);
+
+  Ptr<Packet> received = Convert::ToPacket(*data);
+  shared_ptr<const Data> decoded = Convert::FromPacket<Data>(received->Copy());
+
+  // unmodified Data is sent using the received packet
+  Ptr<Packet> forwarded = Convert::ToPacket(*decoded);
+  BOOST_CHECK_EQUAL(forwarded->GetSize(), received->GetSize());
+  BOOST_CHECK_EQUAL(*Convert::FromPacket<Data>(forwarded), *data);
+
+  // modified Data is re-encoded
+  auto modified = std::make_shared<ndn::Data>(*decoded);
+  modified->setFreshnessPeriod(ndn::time::milliseconds(2000));
+  Ptr<Packet> modifiedPacket = Convert::ToPacket(*modified);
+  BOOST_CHECK_EQUAL(*Convert::FromPacket<Data>(modifiedPacket), *modified);
+}
+
+BOOST_AUTO_TEST_CASE(ToPacketWithCongestionTag)
+{
+  auto data = std::make_shared<ndn::Data>("/prefix/data");
+  ndn::StackHelper::getKeyChain().sign(*data);
+
+  Ptr<Packet> unmarked = Convert::ToPacket(*data);
+  Ns3CCTag ccTag;
+  BOOST_CHECK(!unmarked->PeekPacketTag(ccTag));
+
+  // the mark is given next to the Data, which stays untagged
+  Ptr<Packet> marked = Convert::ToPacket(*data, make_shared< ::ndn::CongestionTag>(-1, 1, true,
+                                                                                   false));
+  BOOST_REQUIRE(marked->PeekPacketTag(ccTag));
+  BOOST_CHECK_EQUAL(ccTag.getCongMark(), 1);
+  BOOST_CHECK_EQUAL(ccTag.getHighCongMark(), true);
+  BOOST_CHECK(data->getTag< ::ndn::CongestionTag>() == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
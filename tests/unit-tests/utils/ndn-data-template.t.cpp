@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-data-template.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnDataTemplate)
+
+static shared_ptr<Data>
+makePrototype(size_t payloadSize, const Name& keyLocator)
+{
+  auto data = make_shared<Data>("/prototype");
+  data->setFreshnessPeriod(::ndn::time::milliseconds(1000));
+  data->setContent(make_shared< ::ndn::Buffer>(payloadSize));
+
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+  if (!keyLocator.empty()) {
+    signatureInfo.setKeyLocator(keyLocator);
+  }
+  Signature signature(signatureInfo);
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 7));
+  data->setSignature(signature);
+  return data;
+}
+
+BOOST_AUTO_TEST_CASE(SameWire)
+{
+  for (size_t payloadSize : {0, 1024, 70000}) {
+    for (const Name& keyLocator : {Name(), Name("/key")}) {
+      shared_ptr<Data> prototype = makePrototype(payloadSize, keyLocator);
+      DataTemplate dataTemplate(*prototype);
+
+      for (const Name& name : {Name("/"), Name("/A/B").appendSequenceNumber(1),
+                               Name("/" + std::string(300, 'C'))}) {
+        shared_ptr<Data> data = dataTemplate.makeData(name);
+        prototype->setName(name);
+
+        BOOST_CHECK_EQUAL(data->getName(), name);
+        BOOST_CHECK_EQUAL(data->getContent().value_size(), payloadSize);
+        const ::ndn::Block& expected = prototype->wireEncode();
+        const ::ndn::Block& actual = data->wireEncode();
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                      expected.begin(), expected.end());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SharedTail)
+{
+  DataTemplate dataTemplate(*makePrototype(1024, Name()));
+  BOOST_CHECK_GT(dataTemplate.getTailSize(), 1024);
+
+  // packets do not share their buffers with each other
+  shared_ptr<Data> data1 = dataTemplate.makeData("/A");
+  shared_ptr<Data> data2 = dataTemplate.makeData("/B");
+  BOOST_CHECK(data1->wireEncode().getBuffer() != data2->wireEncode().getBuffer());
+  BOOST_CHECK_EQUAL(data1->getName(), Name("/A"));
+  BOOST_CHECK_EQUAL(data2->getName(), Name("/B"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
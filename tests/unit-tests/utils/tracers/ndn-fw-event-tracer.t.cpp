@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-fw-event-tracer.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class FwEventTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  FwEventTracerFixture()
+  {
+    // setting default parameters for PointToPoint links and channels
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    //      +-> 2 -+
+    //  1 --|      |--> 4 (no route further)
+    //      +-> 3 -+
+    createTopology({
+        {"1", "2"},
+        {"1", "3"},
+        {"2", "4"},
+        {"3", "4"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+        {"1", "3", "/prefix", 1},
+        {"2", "4", "/prefix", 1},
+        {"3", "4", "/prefix", 1}
+      });
+
+    // node 1 sends every Interest both ways, so each reaches node 4 twice with the same Nonce
+    StrategyChoiceHelper::Install(getNode("1"), "/prefix", "/localhost/nfd/strategy/multicast");
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "0.95s"} // 10 Interests
+      });
+  }
+
+  ~FwEventTracerFixture()
+  {
+    FwEventTracer::Destroy(); // additional cleanup
+  }
+
+  /** \return lines of the trace, one vector of fields per line
+   */
+  static std::vector<std::vector<std::string>>
+  splitTrace(const std::string& trace)
+  {
+    std::vector<std::vector<std::string>> lines;
+    std::istringstream is(trace);
+    std::string line;
+    while (std::getline(is, line)) {
+      std::vector<std::string> fields;
+      boost::split(fields, line, boost::is_any_of("\t"));
+      lines.push_back(fields);
+    }
+    return lines;
+  }
+
+  /** \return sum of the event counts of @p type reported for @p node
+   */
+  static uint64_t
+  sumEvents(const std::vector<std::vector<std::string>>& lines, const std::string& node,
+            const std::string& type)
+  {
+    uint64_t sum = 0;
+    for (const auto& line : lines) {
+      if (line.size() == 4 && line[1] == node && line[2] == type) {
+        sum += std::stoull(line[3]);
+      }
+    }
+    return sum;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnFwEventTracer, FwEventTracerFixture)
+
+BOOST_AUTO_TEST_CASE(CountEvents)
+{
+  auto os = make_shared<std::ostringstream>();
+  std::vector<Ptr<FwEventTracer>> tracers;
+  for (const std::string& node : {"1", "2", "3", "4"}) {
+    tracers.push_back(FwEventTracer::Install(getNode(node), os, Seconds(0.5)));
+  }
+
+  Simulator::Stop(Seconds(2.2));
+  Simulator::Run();
+
+  // every tracer prints the 6 event types at 0.5s, 1s, 1.5s and 2s
+  std::vector<std::vector<std::string>> lines = splitTrace(os->str());
+  BOOST_REQUIRE_EQUAL(lines.size(), 4 * 4 * 6);
+  BOOST_CHECK_EQUAL(lines.front()[0], "0.5");
+  BOOST_CHECK_EQUAL(lines.back()[0], "2");
+
+  // the second copy of an Interest at node 4 is a duplicate Nonce, dropped as a loop
+  uint64_t nDuplicateNonces = sumEvents(lines, "4", "DuplicateNonces");
+  BOOST_CHECK_GE(nDuplicateNonces, 10);
+  BOOST_CHECK_EQUAL(sumEvents(lines, "4", "InterestLoops"), nDuplicateNonces);
+
+  // the first copy finds no nexthop at node 4 and is rejected by the strategy
+  BOOST_CHECK_GE(sumEvents(lines, "4", "RejectedInterests"), 10);
+
+  for (const std::string& node : {"1", "2", "3"}) {
+    BOOST_CHECK_EQUAL(sumEvents(lines, node, "DuplicateNonces"), 0);
+    BOOST_CHECK_EQUAL(sumEvents(lines, node, "InterestLoops"), 0);
+  }
+  for (const std::string& node : {"1", "2", "3", "4"}) {
+    BOOST_CHECK_EQUAL(sumEvents(lines, node, "InNacks"), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DestroyBeforeEnd)
+{
+  auto os = make_shared<std::ostringstream>();
+  Ptr<FwEventTracer> tracer = FwEventTracer::Install(getNode("4"), os, Seconds(0.5));
+
+  Simulator::Stop(Seconds(0.7));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(splitTrace(os->str()).size(), 6);
+
+  // the destroyed tracer no longer prints
+  tracer = nullptr;
+  Simulator::Stop(Seconds(1.5));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(splitTrace(os->str()).size(), 6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
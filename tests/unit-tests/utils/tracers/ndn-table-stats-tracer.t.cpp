@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-table-stats-tracer.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TABLE_STATS_TRACE =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "table-stats.bin";
+
+class TableStatsTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  TableStatsTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    // setting default parameters for PointToPoint links and channels
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"},
+        {"2", "3"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+        {"2", "3", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "0.95s"}, // 10 Interests
+        {"3", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~TableStatsTracerFixture()
+  {
+    boost::filesystem::remove(TABLE_STATS_TRACE);
+    TableStatsTracer::Destroy(); // additional cleanup
+  }
+
+  /** \return the trace as text, one vector of fields per line
+   */
+  std::vector<std::vector<std::string>>
+  readTrace()
+  {
+    std::ifstream is(TABLE_STATS_TRACE.string().c_str(), std::ios_base::binary);
+    std::stringstream text;
+    TableStatsTracer::ConvertToText(is, text);
+
+    std::vector<std::vector<std::string>> lines;
+    std::string line;
+    while (std::getline(text, line)) {
+      std::vector<std::string> fields;
+      boost::split(fields, line, boost::is_any_of("\t"));
+      lines.push_back(fields);
+    }
+    return lines;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnTableStatsTracer, TableStatsTracerFixture)
+
+BOOST_AUTO_TEST_CASE(InstallNodeContainer)
+{
+  NodeContainer nodes;
+  nodes.Add(getNode("2"));
+
+  TableStatsTracer::Install(nodes, TABLE_STATS_TRACE.string(), Seconds(0.5));
+
+  Simulator::Stop(Seconds(2.2));
+  Simulator::Run();
+
+  TableStatsTracer::Destroy(); // to force trace to be written
+
+  std::vector<std::vector<std::string>> lines = readTrace();
+  BOOST_REQUIRE_EQUAL(lines.size(), 5); // header and samples at 0.5s, 1s, 1.5s, 2s
+
+  std::vector<std::string> header = {"Time", "Node"};
+  header.insert(header.end(), TableStatsTracer::GetColumnNames().begin(),
+                TableStatsTracer::GetColumnNames().end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(lines[0].begin(), lines[0].end(), header.begin(), header.end());
+
+  auto getValue = [&] (const std::vector<std::string>& line, const std::string& column) {
+    auto it = std::find(header.begin(), header.end(), column);
+    BOOST_REQUIRE(it != header.end());
+    return line.at(it - header.begin());
+  };
+
+  for (size_t i = 1; i < lines.size(); ++i) {
+    BOOST_CHECK_EQUAL(getValue(lines[i], "Node"), std::to_string(getNode("2")->GetId()));
+  }
+  BOOST_CHECK_EQUAL(getValue(lines[1], "Time"), "0.5");
+  BOOST_CHECK_EQUAL(getValue(lines[4], "Time"), "2");
+
+  // counters are cumulative, table sizes are taken at the time of the sample
+  BOOST_CHECK_EQUAL(getValue(lines[4], "InInterests"), "10");
+  BOOST_CHECK_EQUAL(getValue(lines[4], "OutInterests"), "10");
+  BOOST_CHECK_EQUAL(getValue(lines[4], "InData"), "10");
+  BOOST_CHECK_EQUAL(getValue(lines[4], "OutData"), "10");
+  BOOST_CHECK_EQUAL(getValue(lines[4], "Pit"), "0");
+}
+
+BOOST_AUTO_TEST_CASE(Chunks)
+{
+  // a buffer of 2 rows splits the samples of the 3 nodes across chunks
+  Ptr<TableStatsTracer> tracer = Create<TableStatsTracer>(TABLE_STATS_TRACE.string(),
+                                                          NodeContainer::GetGlobal(),
+                                                          Seconds(0.5), 2);
+  BOOST_REQUIRE(tracer->IsOpen());
+
+  Simulator::Stop(Seconds(2.2));
+  Simulator::Run();
+
+  tracer = nullptr; // destroy tracer
+
+  std::vector<std::vector<std::string>> lines = readTrace();
+  BOOST_REQUIRE_EQUAL(lines.size(), 1 + 4 * 3);
+  const std::vector<std::string> times = {"0.5", "1", "1.5", "2"};
+  for (size_t i = 1; i < lines.size(); ++i) {
+    BOOST_CHECK_EQUAL(lines[i].size(), lines[0].size());
+    BOOST_CHECK_EQUAL(lines[i][0], times[(i - 1) / 3]);
+    BOOST_CHECK_EQUAL(lines[i][1],
+                      std::to_string(NodeContainer::GetGlobal().Get((i - 1) % 3)->GetId()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
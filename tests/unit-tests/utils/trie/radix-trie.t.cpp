@@ -0,0 +1,378 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/ndn-content-store.hpp" // hash_value of name components
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/radix-trie.hpp"
+#include "utils/trie/lru-policy.hpp"
+#include "utils/trie/fifo-policy.hpp"
+#include "utils/trie/lfu-policy.hpp"
+#include "utils/trie/random-policy.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+#include <deque>
+#include <random>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ndnSIM::lru_policy_traits;
+
+typedef boost::mpl::vector<ndnSIM::lru_policy_traits, ndnSIM::fifo_policy_traits,
+                           ndnSIM::lfu_policy_traits, ndnSIM::random_policy_traits> CsPolicies;
+
+/**
+ * @brief Applies the same operations to a classic trie and a radix trie with the same policy,
+ *        and checks that lookups on the radix trie agree with the classic one
+ */
+template<class PolicyTraits>
+class TriePair {
+public:
+  struct Payload {
+    explicit Payload(const Name& name)
+      : name(name)
+    {
+    }
+
+    Name name;
+  };
+
+  typedef ndnSIM::pointer_payload_traits<Payload> PayloadTraits;
+  typedef ndnSIM::trie_with_policy<Name, PayloadTraits, PolicyTraits> ClassicTrie;
+  typedef ndnSIM::trie_with_policy<Name, PayloadTraits, PolicyTraits, ndnSIM::radix_trie>
+    RadixTrie;
+
+  explicit TriePair(size_t maxSize = 0)
+  {
+    classic.getPolicy().set_max_size(maxSize);
+    radix.getPolicy().set_max_size(maxSize);
+  }
+
+  /**
+   * @return whether name was not stored yet
+   */
+  bool
+  insert(const Name& name)
+  {
+    m_payloads.emplace_back(name);
+    bool isNew = classic.insert(name, &m_payloads.back()).second;
+    BOOST_CHECK_EQUAL(radix.insert(name, &m_payloads.back()).second, isNew);
+    return isNew;
+  }
+
+  void
+  erase(const Name& name)
+  {
+    classic.erase(name);
+    radix.erase(name);
+  }
+
+  /**
+   * @brief Number of nodes of the radix trie, including the root
+   */
+  size_t
+  getNRadixNodes() const
+  {
+    size_t nNodes = 0;
+    typedef typename RadixTrie::parent_trie::const_recursive_iterator iterator;
+    for (iterator node(radix.getTrie()), end; node != end; ++node) {
+      ++nNodes;
+    }
+    return nNodes;
+  }
+
+  template<class Iterator>
+  static std::string
+  describe(Iterator item)
+  {
+    return item == 0 ? "(end)" : item->payload()->name.toUri();
+  }
+
+  void
+  check(const Name& query)
+  {
+    BOOST_TEST_MESSAGE("query " << query);
+
+    BOOST_CHECK_EQUAL(describe(radix.find_exact(query)), describe(classic.find_exact(query)));
+    BOOST_CHECK_EQUAL(describe(radix.longest_prefix_match(query)),
+                      describe(classic.longest_prefix_match(query)));
+
+    checkDeepest(query, classic.deepest_prefix_match(query), radix.deepest_prefix_match(query));
+
+    auto isEven = [] (const Payload* payload) { return payload->name.size() % 2 == 0; };
+    typename RadixTrie::iterator item = radix.deepest_prefix_match_if(query, isEven);
+    checkDeepest(query, classic.deepest_prefix_match_if(query, isEven), item);
+    BOOST_CHECK(item == 0 || isEven(item->payload()));
+
+    auto isNotA = [] (const name::Component& component) {
+      return component != name::Component("a");
+    };
+    item = radix.deepest_prefix_match_if_next_level(query, isNotA);
+    checkDeepest(query, classic.deepest_prefix_match_if_next_level(query, isNotA), item);
+    BOOST_CHECK(item == 0 || isNotA(item->payload()->name.get(query.size())));
+  }
+
+private:
+  /**
+   * @brief Checks a deepest prefix match result of the radix trie against the classic one
+   *
+   * A stored prefix of query is the only possible result.  Below query, any stored name may be
+   * returned, as the order in which children are visited differs between the tries.
+   */
+  void
+  checkDeepest(const Name& query, typename ClassicTrie::iterator expected,
+               typename RadixTrie::iterator actual)
+  {
+    BOOST_CHECK_EQUAL(describe(actual) == "(end)", describe(expected) == "(end)");
+    if (actual == 0 || expected == 0) {
+      return;
+    }
+
+    const Name& name = actual->payload()->name;
+    if (expected->payload()->name.size() <= query.size()) {
+      BOOST_CHECK_EQUAL(name, expected->payload()->name);
+    }
+    else {
+      BOOST_CHECK_MESSAGE(name.size() > query.size() && query.isPrefixOf(name),
+                          name << " is not below " << query);
+      BOOST_CHECK(classic.find_exact(name) != 0);
+    }
+  }
+
+public:
+  ClassicTrie classic;
+  RadixTrie radix;
+
+private:
+  std::deque<Payload> m_payloads;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieRadixTrie, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(InsertErase)
+{
+  TriePair<lru_policy_traits> tries;
+  std::vector<Name> queries = {"/", "/a", "/a/b", "/a/b/c", "/a/b/d", "/a/b/c/e", "/b", "/a/c"};
+
+  BOOST_CHECK(tries.insert("/a/b/c"));
+  BOOST_CHECK(tries.insert("/a/b/d"));
+  BOOST_CHECK(tries.insert("/a"));
+  BOOST_CHECK(!tries.insert("/a/b/c"));
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 3);
+  for (const Name& query : queries) {
+    tries.check(query);
+  }
+
+  tries.erase("/a/b/c");
+  tries.erase("/a/b/x"); // not stored
+  tries.erase("/a/b");   // node without payload
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 2);
+  for (const Name& query : queries) {
+    tries.check(query);
+  }
+
+  BOOST_CHECK(tries.insert("/a/b/c"));
+  tries.check("/a/b/c");
+
+  tries.erase("/a/b/c");
+  tries.erase("/a/b/d");
+  tries.erase("/a");
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 0);
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 1);
+  for (const Name& query : queries) {
+    tries.check(query);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SplitAndMerge)
+{
+  TriePair<lru_policy_traits> tries;
+  std::vector<Name> queries = {"/a", "/a/b", "/a/b/c", "/a/b/c/d", "/a/b/c/d/e", "/a/b/c/e",
+                               "/a/b/x", "/a/x", "/b"};
+  auto checkAll = [&] {
+    for (const Name& query : queries) {
+      tries.check(query);
+    }
+  };
+
+  tries.insert("/a/b/c/d");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 2);
+  auto abcd = tries.radix.find_exact("/a/b/c/d");
+  checkAll();
+
+  // [a b c d] is split into [a b] -> [c d], [x]
+  tries.insert("/a/b/x");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 4);
+  checkAll();
+
+  tries.insert("/a/b");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 4);
+  checkAll();
+
+  // [c d] is split into [c] -> [d]
+  tries.insert("/a/b/c");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 5);
+  checkAll();
+
+  // [c] has no payload left, so it is merged back with [d]
+  tries.erase("/a/b/c");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 4);
+  checkAll();
+
+  // [a b] keeps its payload, and has one child left
+  tries.erase("/a/b/x");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 3);
+  checkAll();
+
+  tries.erase("/a/b");
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 2);
+  checkAll();
+
+  // nodes with payload are neither moved nor freed by splits and merges
+  BOOST_CHECK_EQUAL(tries.radix.find_exact("/a/b/c/d"), abcd);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyKey)
+{
+  TriePair<lru_policy_traits> tries;
+  std::vector<Name> queries = {"/", "/a", "/a/b", "/x"};
+  auto checkAll = [&] {
+    for (const Name& query : queries) {
+      tries.check(query);
+    }
+  };
+
+  // an empty trie only has its root, which has no payload
+  checkAll();
+  BOOST_CHECK(tries.radix.deepest_prefix_match(Name()) == tries.radix.end());
+
+  tries.insert("/a/b");
+  checkAll();
+
+  BOOST_CHECK(tries.insert(Name()));
+  BOOST_CHECK(!tries.insert(Name()));
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 2);
+  checkAll();
+  BOOST_CHECK_EQUAL(tries.radix.longest_prefix_match("/x")->payload()->name, Name());
+
+  tries.erase(Name());
+  BOOST_CHECK(tries.radix.find_exact(Name()) == tries.radix.end());
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 2);
+  checkAll();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(DeepestPrefixMatch, PolicyTraits, CsPolicies)
+{
+  TriePair<PolicyTraits> tries;
+
+  // eight components give nodes with both inline and hashed children, and the long prefix gives
+  // multi-component labels
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> component('a', 'h');
+  std::uniform_int_distribution<int> length(1, 4);
+  std::bernoulli_distribution isLong(0.2);
+  std::vector<Name> names;
+  for (int i = 0; i < 300; ++i) {
+    Name name = isLong(rng) ? Name("/long/shared/prefix") : Name();
+    for (int j = length(rng); j > 0; --j) {
+      name.append(std::string(1, component(rng)));
+    }
+    names.push_back(name);
+  }
+
+  std::vector<Name> queries;
+  for (const Name& name : names) {
+    for (size_t i = 0; i <= name.size(); ++i) {
+      queries.push_back(name.getPrefix(i));
+    }
+    queries.push_back(Name(name).append("z"));
+  }
+  auto checkAll = [&] {
+    for (const Name& query : queries) {
+      tries.check(query);
+    }
+  };
+
+  for (size_t i = 0; i < names.size() / 2; ++i) {
+    tries.insert(names[i]);
+  }
+  checkAll();
+
+  std::bernoulli_distribution shouldErase(0.5);
+  for (size_t i = 0; i < names.size() / 2; ++i) {
+    if (shouldErase(rng)) {
+      tries.erase(names[i]);
+    }
+  }
+  for (size_t i = names.size() / 2; i < names.size(); ++i) {
+    tries.insert(names[i]);
+  }
+  checkAll();
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), tries.classic.getPolicy().size());
+
+  for (const Name& name : names) {
+    tries.erase(name);
+  }
+  BOOST_CHECK_EQUAL(tries.getNRadixNodes(), 1);
+  checkAll();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Eviction, PolicyTraits, CsPolicies)
+{
+  TriePair<PolicyTraits> tries(50);
+
+  std::vector<Name> names;
+  for (int i = 0; i < 200; ++i) {
+    names.push_back(Name("/prefix").appendNumber(i % 7).appendNumber(i));
+  }
+
+  if (PolicyTraits::GetName() == "Random") {
+    // the victims, and whether an insert is refused, depend on the random order given to each
+    // entry, so the two tries cannot be compared
+    typename TriePair<PolicyTraits>::Payload payload("/prefix");
+    for (const Name& name : names) {
+      tries.radix.insert(name, &payload);
+    }
+    BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 50);
+    size_t nFound = 0;
+    for (const Name& name : names) {
+      nFound += tries.radix.find_exact(name) != tries.radix.end();
+    }
+    BOOST_CHECK_EQUAL(nFound, 50);
+    return;
+  }
+
+  for (const Name& name : names) {
+    tries.insert(name);
+  }
+  BOOST_CHECK_EQUAL(tries.radix.getPolicy().size(), 50);
+  BOOST_CHECK_EQUAL(tries.classic.getPolicy().size(), 50);
+  for (const Name& name : names) {
+    tries.check(name);
+  }
+  tries.check("/prefix");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
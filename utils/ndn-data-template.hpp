@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DATA_TEMPLATE_H
+#define NDN_DATA_TEMPLATE_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pre-encoded Data packet into which only the Name is filled in
+ *
+ * The wire encoding of a Data packet is its Name followed by MetaInfo, Content, SignatureInfo
+ * and SignatureValue.  The template keeps the encoding of everything after the Name of a
+ * prototype packet in one immutable buffer, so that a packet with any Name costs one
+ * allocation, a copy of the template and parsing of the result, instead of building the
+ * Content, Signature and MetaInfo and encoding them.
+ *
+ * The wire encoding of makeData(name) is identical to that of the prototype with its Name set
+ * to name.
+ */
+class DataTemplate {
+public:
+  /**
+   * @param prototype Data packet whose fields other than the Name are copied into every packet
+   */
+  explicit
+  DataTemplate(const Data& prototype);
+
+  /**
+   * @brief Create a Data packet with the fields of the prototype and Name @p name
+   */
+  shared_ptr<Data>
+  makeData(const Name& name) const;
+
+  /**
+   * @brief Size of the encoding shared by all packets
+   */
+  size_t
+  getTailSize() const
+  {
+    return m_tail->size();
+  }
+
+private:
+  shared_ptr<const ::ndn::Buffer> m_tail; ///< MetaInfo, Content, SignatureInfo, SignatureValue
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DATA_TEMPLATE_H
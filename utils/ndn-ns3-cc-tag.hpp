@@ -95,17 +95,17 @@ public:
     m_highCongMarkLocal = m;
   }
 
-  int8_t getCongMark()
+  int8_t getCongMark() const
   {
     return m_congMark;
   }
 
-  bool getHighCongMark()
+  bool getHighCongMark() const
   {
     return m_highCongMark;
   }
 
-  bool getHighCongMarkLocal()
+  bool getHighCongMarkLocal() const
   {
     return m_highCongMarkLocal;
   }
@@ -22,7 +22,9 @@
 
 #include "ns3/packet.h"
 #include "ns3/ptr.h"
+#include "ndn-ns3-cc-tag.hpp"
 #include <ndn-cxx/tag.hpp>
+#include <ndn-cxx/encoding/block.hpp>
 
 namespace ns3 {
 namespace ndn {
@@ -37,6 +39,20 @@ public:
 
   Ns3PacketTag(Ptr<const Packet> packet)
     : m_packet(packet)
+    , m_hasCCTag(packet->PeekPacketTag(m_ccTag))
+  {
+  }
+
+  /**
+   * @param packet     packet carrying the ns-3 tags, with NDN header removed
+   * @param wirePacket packet as received, with NDN header still in place
+   * @param wire       wire encoding decoded from @p wirePacket
+   */
+  Ns3PacketTag(Ptr<const Packet> packet, Ptr<const Packet> wirePacket, const ::ndn::Block& wire)
+    : m_packet(packet)
+    , m_wirePacket(wirePacket)
+    , m_wire(wire)
+    , m_hasCCTag(packet->PeekPacketTag(m_ccTag))
   {
   }
 
@@ -46,8 +62,38 @@ public:
     return m_packet;
   }
 
+  /**
+   * @brief Get congestion tag carried by the packet, or nullptr if there is none
+   *
+   * The tag is looked up once when Ns3PacketTag is created, so this is a plain field access.
+   */
+  const Ns3CCTag*
+  getCCTag() const
+  {
+    return m_hasCCTag ? &m_ccTag : nullptr;
+  }
+
+  /**
+   * @brief Get the originally received packet (with NDN header), if it still matches @p wire
+   *
+   * Returns nullptr when no such packet was recorded or the NDN packet has been re-encoded
+   * since it was received (i.e., its wire encoding is no longer the recorded one)
+   */
+  Ptr<const Packet>
+  getWirePacket(const ::ndn::Block& wire) const
+  {
+    if (m_wirePacket == nullptr || wire.wire() != m_wire.wire()) {
+      return nullptr;
+    }
+    return m_wirePacket;
+  }
+
 private:
   Ptr<const Packet> m_packet;
+  Ptr<const Packet> m_wirePacket;
+  ::ndn::Block m_wire; // also keeps the decoded buffer alive, so its address cannot be reused
+  Ns3CCTag m_ccTag;
+  bool m_hasCCTag;
 };
 
 } // namespace ndn
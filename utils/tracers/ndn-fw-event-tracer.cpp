@@ -0,0 +1,256 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ndn-fw-event-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "daemon/fw/forwarder.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.FwEventTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<FwEventTracer>>>> g_tracers;
+
+void
+FwEventTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+FwEventTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  std::list<Ptr<FwEventTracer>> tracers;
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<FwEventTracer> trace = Install(*node, outputStream, averagingPeriod);
+    tracers.push_back(trace);
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+FwEventTracer::Install(const NodeContainer& nodes, const std::string& file,
+                       Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  std::list<Ptr<FwEventTracer>> tracers;
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    Ptr<FwEventTracer> trace = Install(*node, outputStream, averagingPeriod);
+    tracers.push_back(trace);
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+FwEventTracer::Install(Ptr<Node> node, const std::string& file,
+                       Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  std::list<Ptr<FwEventTracer>> tracers;
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  Ptr<FwEventTracer> trace = Install(node, outputStream, averagingPeriod);
+  tracers.push_back(trace);
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+Ptr<FwEventTracer>
+FwEventTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                       Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<FwEventTracer> trace = Create<FwEventTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+FwEventTracer::FwEventTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+  m_forwarder = m_nodePtr->GetObject<L3Protocol>()->getForwarder();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+
+  Reset();
+}
+
+FwEventTracer::~FwEventTracer()
+{
+  m_printEvent.Cancel();
+  m_os->flush();
+}
+
+void
+FwEventTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &FwEventTracer::PeriodicPrinter, this);
+}
+
+void
+FwEventTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+  Reset();
+
+  m_printEvent = Simulator::Schedule(m_period, &FwEventTracer::PeriodicPrinter, this);
+}
+
+void
+FwEventTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Packets"
+     << "\t";
+}
+
+void
+FwEventTracer::Reset()
+{
+  m_lastCounters = GetCounters();
+}
+
+fwevent::Stats
+FwEventTracer::GetCounters() const
+{
+  const nfd::ForwarderCounters& counters = m_forwarder->getCounters();
+
+  fwevent::Stats stats;
+  stats.m_duplicateNonces = counters.getNDuplicateNonces();
+  stats.m_interestLoops = counters.getNInterestLoops();
+  stats.m_inNacks = counters.getNInNacks();
+  stats.m_pitCongestionMarks = counters.getNPitCongestionMarks();
+  stats.m_blockedInterests = counters.getNBlockedInterests();
+  stats.m_rejectedInterests = counters.getNRejectedInterests();
+  return stats;
+}
+
+#define PRINTER(printName, fieldName)                                                              \
+  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << printName << "\t"                      \
+     << (current.fieldName - m_lastCounters.fieldName) << "\n";
+
+void
+FwEventTracer::Print(std::ostream& os) const
+{
+  Time time = Simulator::Now();
+  fwevent::Stats current = GetCounters();
+
+  PRINTER("InterestLoops", m_interestLoops);
+  PRINTER("DuplicateNonces", m_duplicateNonces);
+  PRINTER("InNacks", m_inNacks);
+  PRINTER("PitCongestionMarks", m_pitCongestionMarks);
+  PRINTER("BlockedInterests", m_blockedInterests);
+  PRINTER("RejectedInterests", m_rejectedInterests);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef NDN_FW_EVENT_TRACER_H
+#define NDN_FW_EVENT_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <tuple>
+#include <list>
+
+namespace nfd {
+class Forwarder;
+} // namespace nfd
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+namespace fwevent {
+
+/// @cond include_hidden
+struct Stats {
+  inline void
+  Reset()
+  {
+    m_duplicateNonces = 0;
+    m_interestLoops = 0;
+    m_inNacks = 0;
+    m_pitCongestionMarks = 0;
+    m_blockedInterests = 0;
+    m_rejectedInterests = 0;
+  }
+  uint64_t m_duplicateNonces;
+  uint64_t m_interestLoops;
+  uint64_t m_inNacks;
+  uint64_t m_pitCongestionMarks;
+  uint64_t m_blockedInterests;
+  uint64_t m_rejectedInterests;
+};
+/// @endcond
+}
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN tracer for forwarding events (Interest loops, duplicate Nonces, NACKs,
+ *        congestion-marked PIT entries, blocked and rejected Interests)
+ *
+ * The events are counted by nfd::ForwarderCounters; the tracer only samples the counters
+ * every averaging period and writes the number of events in that period.
+ */
+class FwEventTracer : public SimpleRefCount<FwEventTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *second)
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *second)
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *second)
+   */
+  static Ptr<FwEventTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+          Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  FwEventTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  /**
+   * @brief Destructor
+   */
+  ~FwEventTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print current trace data
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  SetAveragingPeriod(const Time& period);
+
+  void
+  Reset();
+
+  void
+  PeriodicPrinter();
+
+  fwevent::Stats
+  GetCounters() const;
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+  shared_ptr<nfd::Forwarder> m_forwarder;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  fwevent::Stats m_lastCounters; ///< counter values at the beginning of the current period
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_FW_EVENT_TRACER_H
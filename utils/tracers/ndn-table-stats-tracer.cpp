@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-table-stats-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "daemon/fw/forwarder.hpp"
+
+#include <algorithm>
+#include <list>
+
+NS_LOG_COMPONENT_DEFINE("ndn.TableStatsTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<Ptr<TableStatsTracer>> g_tracers;
+
+const char TableStatsTracer::MAGIC[4] = {'T', 'S', 'T', '1'};
+
+void
+TableStatsTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+TableStatsTracer::InstallAll(const std::string& file, Time period /* = Seconds (0.5)*/)
+{
+  Install(NodeContainer::GetGlobal(), file, period);
+}
+
+void
+TableStatsTracer::Install(const NodeContainer& nodes, const std::string& file,
+                          Time period /* = Seconds (0.5)*/)
+{
+  Ptr<TableStatsTracer> tracer = Create<TableStatsTracer>(file, nodes, period);
+  if (!tracer->IsOpen()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return;
+  }
+
+  g_tracers.push_back(tracer);
+}
+
+const std::vector<std::string>&
+TableStatsTracer::GetColumnNames()
+{
+  // must match the order of values in Sample()
+  static const std::vector<std::string> names = {
+    "InInterests", "OutInterests", "InData", "OutData",
+    "DuplicateNonces", "InterestLoops", "InNacks", "PitCongestionMarks", "BlockedInterests",
+    "Pit", "Fib", "Cs", "Measurements", "NameTree", "DeadNonceList"
+  };
+  return names;
+}
+
+TableStatsTracer::TableStatsTracer(const std::string& file, const NodeContainer& nodes,
+                                   Time period, size_t capacity)
+  : m_period(period)
+  , m_capacity(std::max<size_t>(capacity, 1))
+  , m_columns(GetColumnNames().size())
+{
+  m_os.open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  if (!m_os.is_open()) {
+    return;
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    NS_LOG_DEBUG("Node: " << (*node)->GetId());
+    m_forwarders.push_back(std::make_pair((*node)->GetId(),
+                                          (*node)->GetObject<L3Protocol>()->getForwarder()));
+  }
+
+  m_times.reserve(m_capacity);
+  m_nodeIds.reserve(m_capacity);
+  for (std::vector<uint64_t>& column : m_columns) {
+    column.reserve(m_capacity);
+  }
+
+  m_os.write(MAGIC, sizeof(MAGIC));
+  uint32_t nColumns = m_columns.size();
+  m_os.write(reinterpret_cast<const char*>(&nColumns), sizeof(nColumns));
+  for (const std::string& name : GetColumnNames()) {
+    uint32_t length = name.size();
+    m_os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    m_os.write(name.data(), length);
+  }
+
+  m_sampleEvent = Simulator::Schedule(m_period, &TableStatsTracer::PeriodicSampler, this);
+}
+
+TableStatsTracer::~TableStatsTracer()
+{
+  m_sampleEvent.Cancel();
+  if (m_os.is_open()) {
+    Flush();
+  }
+}
+
+bool
+TableStatsTracer::IsOpen() const
+{
+  return m_os.is_open();
+}
+
+void
+TableStatsTracer::Flush()
+{
+  WriteBuffer();
+  m_os.flush();
+}
+
+void
+TableStatsTracer::PeriodicSampler()
+{
+  for (const auto& node : m_forwarders) {
+    Sample(node.first, *node.second);
+  }
+
+  m_sampleEvent = Simulator::Schedule(m_period, &TableStatsTracer::PeriodicSampler, this);
+}
+
+void
+TableStatsTracer::Sample(uint32_t nodeId, nfd::Forwarder& forwarder)
+{
+  const nfd::ForwarderCounters& counters = forwarder.getCounters();
+  const uint64_t values[] = {
+    counters.getNInInterests(), counters.getNOutInterests(),
+    counters.getNInDatas(), counters.getNOutDatas(),
+    counters.getNDuplicateNonces(), counters.getNInterestLoops(), counters.getNInNacks(),
+    counters.getNPitCongestionMarks(), counters.getNBlockedInterests(),
+    forwarder.getPit().size(), forwarder.getFib().size(), forwarder.getCs().size(),
+    forwarder.getMeasurements().size(), forwarder.getNameTree().size(),
+    forwarder.getDeadNonceList().size()
+  };
+  static_assert(sizeof(values) / sizeof(values[0]) == 15, "update GetColumnNames()");
+  BOOST_ASSERT(m_columns.size() == sizeof(values) / sizeof(values[0]));
+
+  m_times.push_back(Simulator::Now().ToDouble(Time::S));
+  m_nodeIds.push_back(nodeId);
+  for (size_t i = 0; i < m_columns.size(); ++i) {
+    m_columns[i].push_back(values[i]);
+  }
+
+  if (m_times.size() == m_capacity) {
+    WriteBuffer();
+  }
+}
+
+void
+TableStatsTracer::WriteBuffer()
+{
+  if (m_times.empty()) {
+    return;
+  }
+
+  uint32_t nRows = m_times.size();
+  m_os.write(reinterpret_cast<const char*>(&nRows), sizeof(nRows));
+  m_os.write(reinterpret_cast<const char*>(m_times.data()), nRows * sizeof(double));
+  m_os.write(reinterpret_cast<const char*>(m_nodeIds.data()), nRows * sizeof(uint32_t));
+  for (std::vector<uint64_t>& column : m_columns) {
+    m_os.write(reinterpret_cast<const char*>(column.data()), nRows * sizeof(uint64_t));
+    column.clear();
+  }
+
+  m_times.clear();
+  m_nodeIds.clear();
+}
+
+template<typename T>
+static void
+readColumn(std::istream& is, std::vector<T>& column, uint32_t nRows)
+{
+  column.resize(nRows);
+  if (!is.read(reinterpret_cast<char*>(column.data()), nRows * sizeof(T))) {
+    BOOST_THROW_EXCEPTION(std::runtime_error("Truncated table statistics trace"));
+  }
+}
+
+void
+TableStatsTracer::ConvertToText(std::istream& is, std::ostream& os, char separator)
+{
+  char magic[sizeof(MAGIC)];
+  uint32_t nColumns = 0;
+  if (!is.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC) ||
+      !is.read(reinterpret_cast<char*>(&nColumns), sizeof(nColumns))) {
+    BOOST_THROW_EXCEPTION(std::runtime_error("Not a table statistics trace"));
+  }
+
+  os << "Time" << separator << "Node";
+  for (uint32_t i = 0; i < nColumns; ++i) {
+    uint32_t length = 0;
+    is.read(reinterpret_cast<char*>(&length), sizeof(length));
+    std::string name(length, '\0');
+    if (!is.read(&name[0], length)) {
+      BOOST_THROW_EXCEPTION(std::runtime_error("Truncated table statistics trace"));
+    }
+    os << separator << name;
+  }
+  os << "\n";
+
+  std::vector<double> times;
+  std::vector<uint32_t> nodeIds;
+  std::vector<std::vector<uint64_t>> columns(nColumns);
+  uint32_t nRows;
+  while (is.read(reinterpret_cast<char*>(&nRows), sizeof(nRows))) {
+    readColumn(is, times, nRows);
+    readColumn(is, nodeIds, nRows);
+    for (std::vector<uint64_t>& column : columns) {
+      readColumn(is, column, nRows);
+    }
+
+    for (uint32_t row = 0; row < nRows; ++row) {
+      os << times[row] << separator << nodeIds[row];
+      for (const std::vector<uint64_t>& column : columns) {
+        os << separator << column[row];
+      }
+      os << "\n";
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_TABLE_STATS_TRACER_H
+#define NDN_TABLE_STATS_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <fstream>
+
+namespace nfd {
+class Forwarder;
+} // namespace nfd
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN tracer for forwarder counters and NFD table sizes, written as a binary columnar
+ *        trace
+ *
+ * Every sampling period, one row is recorded for each traced node: the cumulative counters of
+ * nfd::ForwarderCounters and the number of entries in the PIT, FIB, CS, Measurements, Name Tree
+ * and Dead Nonce List.  Rows are kept in memory column by column and written out as one chunk
+ * when the buffer is full and on destruction, so nothing is formatted during the simulation.
+ *
+ * The file starts with MAGIC, followed by the names of the value columns and the chunks:
+ * \code
+ *   uint32 nColumns; { uint32 length; char name[length]; } * nColumns
+ *   { uint32 nRows; double time[nRows]; uint32 node[nRows]; uint64 values[nColumns][nRows]; } *
+ * \endcode
+ * All fields are in host byte order.  ConvertToText() and examples/graphs/table-stats-to-csv.py
+ * turn such a file into a table with one line per row.
+ */
+class TableStatsTracer : public SimpleRefCount<TableStatsTracer> {
+public:
+  static const char MAGIC[4];
+
+  /**
+   * @brief Helper method to install the tracer on all simulation nodes
+   *
+   * @param file File to which the trace will be written
+   * @param period How often the counters and table sizes are sampled (default, every half
+   *second)
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install the tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which the trace will be written
+   * @param period How often the counters and table sizes are sampled (default, every half
+   *second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(0.5));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * The buffered rows are written out when a tracer is removed, so the trace is complete only
+   * after this call (or at the end of the program).
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Tracer that samples @p nodes, each of which must have the NDN stack installed
+   * @param file   name of the output file
+   * @param nodes  nodes to sample
+   * @param period sampling period
+   * @param capacity number of rows buffered before they are written out
+   */
+  TableStatsTracer(const std::string& file, const NodeContainer& nodes, Time period,
+                   size_t capacity = 4096);
+
+  ~TableStatsTracer();
+
+  /**
+   * @brief Whether the output file could be opened
+   */
+  bool
+  IsOpen() const;
+
+  /**
+   * @brief Write out all buffered rows
+   */
+  void
+  Flush();
+
+  /**
+   * @brief Names of the value columns, in file order
+   */
+  static const std::vector<std::string>&
+  GetColumnNames();
+
+  /**
+   * @brief Convert binary trace @p is into a table with a header line
+   * @param separator column separator, e.g. ',' for CSV
+   * @throw std::runtime_error @p is is not a complete table statistics trace
+   */
+  static void
+  ConvertToText(std::istream& is, std::ostream& os, char separator = '\t');
+
+private:
+  void
+  PeriodicSampler();
+
+  void
+  Sample(uint32_t nodeId, nfd::Forwarder& forwarder);
+
+  void
+  WriteBuffer();
+
+private:
+  std::ofstream m_os;
+  std::vector<std::pair<uint32_t, shared_ptr<nfd::Forwarder>>> m_forwarders;
+
+  Time m_period;
+  EventId m_sampleEvent;
+
+  size_t m_capacity;
+  std::vector<double> m_times;
+  std::vector<uint32_t> m_nodeIds;
+  std::vector<std::vector<uint64_t>> m_columns; ///< one vector per value column
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_TABLE_STATS_TRACER_H
@@ -0,0 +1,874 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef RADIX_TRIE_H_
+#define RADIX_TRIE_H_
+
+/// @cond include_hidden
+
+#include "trie.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <new>
+#include <tuple>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Fixed-size blocks for the nodes of one trie, allocated in chunks and reused through a
+ *        free list
+ */
+template<size_t BlockSize>
+class node_pool {
+public:
+  node_pool()
+    : free_(0)
+    , next_(0)
+    , nLeftInChunk_(0)
+  {
+  }
+
+  ~node_pool()
+  {
+    for (char* chunk : chunks_) {
+      ::operator delete(chunk);
+    }
+  }
+
+  node_pool(const node_pool&) = delete;
+
+  node_pool&
+  operator=(const node_pool&) = delete;
+
+  inline void*
+  allocate()
+  {
+    if (free_ != 0) {
+      free_block* block = free_;
+      free_ = block->next;
+      return block;
+    }
+
+    if (nLeftInChunk_ == 0) {
+      chunks_.push_back(static_cast<char*>(::operator new(BLOCK_SIZE * CHUNK_SIZE)));
+      next_ = chunks_.back();
+      nLeftInChunk_ = CHUNK_SIZE;
+    }
+    void* block = next_;
+    next_ += BLOCK_SIZE;
+    --nLeftInChunk_;
+    return block;
+  }
+
+  inline void
+  deallocate(void* block)
+  {
+    free_block* freeBlock = static_cast<free_block*>(block);
+    freeBlock->next = free_;
+    free_ = freeBlock;
+  }
+
+private:
+  struct free_block {
+    free_block* next;
+  };
+
+  // blocks are a multiple of the pointer size, so that they stay aligned within a chunk
+  static const size_t BLOCK_SIZE =
+    (BlockSize + sizeof(free_block) - 1) / sizeof(free_block) * sizeof(free_block);
+  static const size_t CHUNK_SIZE = 256;
+
+  std::vector<char*> chunks_;
+  free_block* free_;
+  char* next_;
+  size_t nLeftInChunk_;
+};
+
+template<class T>
+class radix_trie_iterator;
+
+/**
+ * @brief Path-compressed version of trie, with the same interface as far as trie_with_policy
+ *        and the policies use it
+ *
+ * Each node is labeled with one or more name components, so a chain of nodes that have one child
+ * and no payload is stored as a single node.  Nodes are allocated from a pool owned by the root.
+ * Up to INLINE_CHILDREN children are kept in an array inside the node and found by comparing
+ * their first component; more children go to an open addressing hash table.
+ *
+ * Nodes with a payload are never moved or freed while they hold it: splitting a label creates a
+ * new node above the existing one, and merging removes the node without payload.
+ */
+template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+class radix_trie {
+public:
+  typedef typename FullKey::value_type Key;
+
+  typedef radix_trie* iterator;
+  typedef const radix_trie* const_iterator;
+
+  typedef radix_trie_iterator<radix_trie> recursive_iterator;
+  typedef radix_trie_iterator<const radix_trie> const_recursive_iterator;
+
+  typedef PayloadTraits payload_traits;
+
+  /**
+   * @brief Create the root of a trie
+   *
+   * Bucket sizes are accepted for compatibility with trie and are not used.
+   */
+  inline radix_trie(const Key& key, size_t bucketSize = 1, size_t bucketIncrement = 1)
+    : key_(key)
+    , tail_(0)
+    , labelSize_(0)
+    , nChildren_(0)
+    , capacity_(0)
+    , hash_(0)
+    , payload_(PayloadTraits::empty_payload)
+    , parent_(0)
+    , pool_(new pool_type)
+  {
+  }
+
+  inline ~radix_trie()
+  {
+    payload_ = PayloadTraits::empty_payload; // necessary for smart pointers...
+    clear();
+    delete[] tail_;
+
+    if (parent_ == 0) {
+      delete pool_;
+    }
+  }
+
+  radix_trie(const radix_trie&) = delete;
+
+  radix_trie&
+  operator=(const radix_trie&) = delete;
+
+  void
+  clear()
+  {
+    if (capacity_ == 0) {
+      for (uint32_t i = 0; i < nChildren_; ++i) {
+        destroy_node(children_.inline_children[i]);
+      }
+    }
+    else {
+      for (uint32_t i = 0; i < capacity_; ++i) {
+        if (children_.table[i] != 0) {
+          destroy_node(children_.table[i]);
+        }
+      }
+      delete[] children_.table;
+      capacity_ = 0;
+    }
+    nChildren_ = 0;
+  }
+
+  inline std::pair<iterator, bool>
+  insert(const FullKey& key, typename PayloadTraits::insert_type payload)
+  {
+    radix_trie* trieNode = this;
+
+    typename FullKey::const_iterator subkey = key.begin();
+    while (subkey != key.end()) {
+      radix_trie* child = trieNode->find_child(*subkey);
+      if (child == 0) {
+        child = create_node(subkey, key.end());
+        trieNode->add_child(child);
+        trieNode = child;
+        break;
+      }
+
+      size_t nMatched = child->match_label(subkey, key.end());
+      if (nMatched < child->labelSize_) {
+        child->split_label(nMatched);
+        child = child->parent_;
+      }
+      trieNode = child;
+      subkey += nMatched;
+    }
+
+    if (trieNode->payload_ == PayloadTraits::empty_payload) {
+      trieNode->payload_ = payload;
+      return std::make_pair(trieNode, true);
+    }
+    else
+      return std::make_pair(trieNode, false);
+  }
+
+  /**
+   * @brief Removes payload (if it exists) and prunes or merges nodes that are no longer needed
+   */
+  inline iterator
+  erase()
+  {
+    payload_ = PayloadTraits::empty_payload;
+    return prune();
+  }
+
+  /**
+   * @brief Do exactly as erase, but without erasing the payload
+   */
+  inline iterator
+  prune()
+  {
+    if (payload_ != PayloadTraits::empty_payload || parent_ == 0) {
+      return this;
+    }
+
+    if (nChildren_ == 0) {
+      radix_trie* parent = parent_;
+      parent->remove_child(this);
+      destroy_node(this);
+      return parent->prune();
+    }
+
+    if (nChildren_ == 1) {
+      return merge_with_child();
+    }
+    return this;
+  }
+
+  /**
+   * @brief Perform the longest prefix match
+   * @param key the key for which to perform the longest prefix match
+   *
+   * @return the deepest node with payload whose name is a prefix of key; whether all of key was
+   *         matched; and the node under which all names starting with key are, which is the
+   *         node of key itself unless key ends inside a label
+   */
+  inline std::tuple<iterator, bool, iterator>
+  find(const FullKey& key)
+  {
+    return find_if(key, [] (typename PayloadTraits::const_return_type) { return true; });
+  }
+
+  /**
+   * @brief Perform the longest prefix match satisfying preficate
+   */
+  template<class Predicate>
+  inline std::tuple<iterator, bool, iterator>
+  find_if(const FullKey& key, Predicate pred)
+  {
+    radix_trie* trieNode = this;
+    iterator foundNode = (payload_ != PayloadTraits::empty_payload && pred(payload_)) ? this : 0;
+
+    typename FullKey::const_iterator subkey = key.begin();
+    while (subkey != key.end()) {
+      radix_trie* child = trieNode->find_child(*subkey);
+      if (child == 0) {
+        return std::make_tuple(foundNode, false, trieNode);
+      }
+
+      size_t nMatched = child->match_label(subkey, key.end());
+      if (nMatched < child->labelSize_) {
+        bool reachLast = subkey + nMatched == key.end();
+        return std::make_tuple(foundNode, reachLast, reachLast ? child : trieNode);
+      }
+
+      trieNode = child;
+      subkey += nMatched;
+      if (trieNode->payload_ != PayloadTraits::empty_payload && pred(trieNode->payload_)) {
+        foundNode = trieNode;
+      }
+    }
+
+    return std::make_tuple(foundNode, true, trieNode);
+  }
+
+  /**
+   * @brief Find the node of exactly key, whether or not it has payload
+   * @returns end() if there is no such node
+   */
+  inline iterator
+  find_exact(const FullKey& key)
+  {
+    radix_trie* trieNode = this;
+
+    typename FullKey::const_iterator subkey = key.begin();
+    while (subkey != key.end()) {
+      radix_trie* child = trieNode->find_child(*subkey);
+      if (child == 0) {
+        return 0;
+      }
+
+      size_t nMatched = child->match_label(subkey, key.end());
+      if (nMatched < child->labelSize_) {
+        return 0;
+      }
+      trieNode = child;
+      subkey += nMatched;
+    }
+    return trieNode;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie
+   * @returns end() or a valid iterator pointing to the trie leaf (order is not defined)
+   */
+  inline iterator
+  find()
+  {
+    if (payload_ != PayloadTraits::empty_payload)
+      return this;
+
+    for (radix_trie* child = first_child(); child != 0; child = next_child(child)) {
+      iterator value = child->find();
+      if (value != 0)
+        return value;
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie satisfying the predicate
+   * @returns end() or a valid iterator pointing to the trie leaf (order is not defined)
+   */
+  template<class Predicate>
+  inline iterator
+  find_if(Predicate pred)
+  {
+    if (payload_ != PayloadTraits::empty_payload && pred(payload_))
+      return this;
+
+    for (radix_trie* child = first_child(); child != 0; child = next_child(child)) {
+      iterator value = child->find_if(pred);
+      if (value != 0)
+        return value;
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Find a payload under key, in the first subtree whose component following key
+   *        satisfies the predicate
+   */
+  template<class Predicate>
+  inline iterator
+  find_if_next_level(const FullKey& key, Predicate pred)
+  {
+    radix_trie* trieNode = this;
+
+    typename FullKey::const_iterator subkey = key.begin();
+    while (subkey != key.end()) {
+      radix_trie* child = trieNode->find_child(*subkey);
+      if (child == 0) {
+        return 0;
+      }
+
+      size_t nMatched = child->match_label(subkey, key.end());
+      if (nMatched < child->labelSize_) {
+        if (subkey + nMatched != key.end()) {
+          return 0;
+        }
+        // key ends inside the label of child, which holds the only next component
+        return pred(child->label(nMatched)) ? child->find() : 0;
+      }
+      trieNode = child;
+      subkey += nMatched;
+    }
+
+    for (radix_trie* child = trieNode->first_child(); child != 0;
+         child = trieNode->next_child(child)) {
+      if (pred(child->key())) {
+        return child->find();
+      }
+    }
+    return 0;
+  }
+
+  iterator
+  end()
+  {
+    return 0;
+  }
+
+  const_iterator
+  end() const
+  {
+    return 0;
+  }
+
+  typename PayloadTraits::const_return_type
+  payload() const
+  {
+    return payload_;
+  }
+
+  typename PayloadTraits::return_type
+  payload()
+  {
+    return payload_;
+  }
+
+  void
+  set_payload(typename PayloadTraits::insert_type payload)
+  {
+    payload_ = payload;
+  }
+
+  /**
+   * @brief First name component of the label
+   */
+  Key
+  key() const
+  {
+    return key_;
+  }
+
+public:
+  PolicyHook policy_hook_;
+
+  static const uint32_t INLINE_CHILDREN = 4;
+
+private:
+  struct pool_type;
+
+  explicit radix_trie(pool_type* pool)
+    : tail_(0)
+    , labelSize_(0)
+    , nChildren_(0)
+    , capacity_(0)
+    , hash_(0)
+    , payload_(PayloadTraits::empty_payload)
+    , parent_(0)
+    , pool_(pool)
+  {
+  }
+
+  static size_t
+  hash_key(const Key& key)
+  {
+    return boost::hash_value(key);
+  }
+
+  const Key&
+  label(size_t i) const
+  {
+    return i == 0 ? key_ : tail_[i - 1];
+  }
+
+  /**
+   * @brief Set the label to the components in [first, last), which must not be empty
+   */
+  template<class Iterator>
+  void
+  set_label(Iterator first, Iterator last)
+  {
+    Key* tail = 0;
+    size_t size = last - first;
+    if (size > 1) {
+      tail = new Key[size - 1];
+      std::copy(first + 1, last, tail);
+    }
+    key_ = *first;
+    delete[] tail_;
+    tail_ = tail;
+    labelSize_ = size;
+    hash_ = hash_key(key_);
+  }
+
+  /**
+   * @brief Number of leading components of [subkey, end) that match the label
+   */
+  size_t
+  match_label(typename FullKey::const_iterator subkey,
+              typename FullKey::const_iterator end) const
+  {
+    // the first component was matched by find_child
+    size_t nMatched = 1;
+    for (++subkey; nMatched < labelSize_ && subkey != end && *subkey == tail_[nMatched - 1];
+         ++subkey) {
+      ++nMatched;
+    }
+    return nMatched;
+  }
+
+  radix_trie*
+  create_node(typename FullKey::const_iterator first, typename FullKey::const_iterator last)
+  {
+    radix_trie* node = new (pool_->allocate()) radix_trie(pool_);
+    node->set_label(first, last);
+    return node;
+  }
+
+  void
+  destroy_node(radix_trie* node)
+  {
+    pool_type* pool = pool_;
+    node->~radix_trie();
+    pool->deallocate(node);
+  }
+
+  /**
+   * @brief Keep the first nMatched components of the label in a new node inserted above this one
+   */
+  void
+  split_label(size_t nMatched)
+  {
+    radix_trie* parent = parent_;
+
+    std::vector<Key> label;
+    label.reserve(labelSize_);
+    for (size_t i = 0; i < labelSize_; ++i) {
+      label.push_back(this->label(i));
+    }
+
+    radix_trie* upper = new (pool_->allocate()) radix_trie(pool_);
+    upper->set_label(label.begin(), label.begin() + nMatched);
+    parent->replace_child(this, upper);
+
+    set_label(label.begin() + nMatched, label.end());
+    upper->add_child(this);
+  }
+
+  /**
+   * @brief Replace this node, which has no payload and one child, by its child
+   */
+  radix_trie*
+  merge_with_child()
+  {
+    radix_trie* child = first_child();
+    radix_trie* parent = parent_;
+
+    std::vector<Key> label;
+    label.reserve(labelSize_ + child->labelSize_);
+    for (size_t i = 0; i < labelSize_; ++i) {
+      label.push_back(this->label(i));
+    }
+    for (size_t i = 0; i < child->labelSize_; ++i) {
+      label.push_back(child->label(i));
+    }
+    child->set_label(label.begin(), label.end());
+
+    parent->replace_child(this, child);
+    child->parent_ = parent;
+
+    // the child is no longer ours to destroy
+    if (capacity_ != 0) {
+      delete[] children_.table;
+      capacity_ = 0;
+    }
+    nChildren_ = 0;
+    destroy_node(this);
+    return child;
+  }
+
+  ////////////////////////////////////////////////
+  // Children
+  ////////////////////////////////////////////////
+
+  radix_trie*
+  find_child(const Key& key) const
+  {
+    if (capacity_ == 0) {
+      for (uint32_t i = 0; i < nChildren_; ++i) {
+        if (children_.inline_children[i]->key_ == key) {
+          return children_.inline_children[i];
+        }
+      }
+      return 0;
+    }
+
+    size_t hash = hash_key(key);
+    size_t mask = capacity_ - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+      radix_trie* child = children_.table[i];
+      if (child == 0) {
+        return 0;
+      }
+      if (child->hash_ == hash && child->key_ == key) {
+        return child;
+      }
+    }
+  }
+
+  size_t
+  find_slot(const radix_trie* child) const
+  {
+    size_t mask = capacity_ - 1;
+    size_t i = child->hash_ & mask;
+    while (children_.table[i] != child) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void
+  add_child(radix_trie* child)
+  {
+    child->parent_ = this;
+
+    if (capacity_ == 0 && nChildren_ < INLINE_CHILDREN) {
+      children_.inline_children[nChildren_++] = child;
+      return;
+    }
+
+    if (capacity_ == 0 || (nChildren_ + 1) * 2 > capacity_) {
+      rehash(capacity_ == 0 ? 4 * INLINE_CHILDREN : 2 * capacity_);
+    }
+    insert_into_table(child);
+    ++nChildren_;
+  }
+
+  void
+  replace_child(const radix_trie* oldChild, radix_trie* newChild)
+  {
+    // both have the same first component
+    if (capacity_ == 0) {
+      for (uint32_t i = 0; i < nChildren_; ++i) {
+        if (children_.inline_children[i] == oldChild) {
+          children_.inline_children[i] = newChild;
+        }
+      }
+    }
+    else {
+      children_.table[find_slot(oldChild)] = newChild;
+    }
+    newChild->parent_ = this;
+  }
+
+  void
+  remove_child(const radix_trie* child)
+  {
+    if (capacity_ == 0) {
+      uint32_t i = 0;
+      while (children_.inline_children[i] != child) {
+        ++i;
+      }
+      for (--nChildren_; i < nChildren_; ++i) {
+        children_.inline_children[i] = children_.inline_children[i + 1];
+      }
+      return;
+    }
+
+    // backward shift deletion, so that probe sequences stay without holes
+    size_t mask = capacity_ - 1;
+    size_t hole = find_slot(child);
+    for (size_t i = (hole + 1) & mask; children_.table[i] != 0; i = (i + 1) & mask) {
+      size_t home = children_.table[i]->hash_ & mask;
+      bool canMove = hole <= i ? (home <= hole || home > i) : (home <= hole && home > i);
+      if (canMove) {
+        children_.table[hole] = children_.table[i];
+        hole = i;
+      }
+    }
+    children_.table[hole] = 0;
+    --nChildren_;
+
+    if (nChildren_ <= INLINE_CHILDREN / 2) {
+      rehash(0);
+    }
+  }
+
+  /**
+   * @brief Move children to a table of capacity slots, or inline if capacity is 0
+   */
+  void
+  rehash(uint32_t capacity)
+  {
+    radix_trie* inlineChildren[INLINE_CHILDREN];
+    radix_trie** oldChildren = inlineChildren;
+    uint32_t nOldSlots = nChildren_;
+    if (capacity_ == 0) {
+      std::copy(children_.inline_children, children_.inline_children + nChildren_,
+                inlineChildren);
+    }
+    else {
+      oldChildren = children_.table;
+      nOldSlots = capacity_;
+    }
+
+    capacity_ = capacity;
+    if (capacity_ != 0) {
+      children_.table = new radix_trie*[capacity_]();
+    }
+
+    uint32_t nInline = 0;
+    for (uint32_t i = 0; i < nOldSlots; ++i) {
+      if (oldChildren[i] == 0) {
+        continue;
+      }
+      if (capacity_ == 0) {
+        children_.inline_children[nInline++] = oldChildren[i];
+      }
+      else {
+        insert_into_table(oldChildren[i]);
+      }
+    }
+
+    if (oldChildren != inlineChildren) {
+      delete[] oldChildren;
+    }
+  }
+
+  void
+  insert_into_table(radix_trie* child)
+  {
+    size_t mask = capacity_ - 1;
+    size_t i = child->hash_ & mask;
+    while (children_.table[i] != 0) {
+      i = (i + 1) & mask;
+    }
+    children_.table[i] = child;
+  }
+
+  radix_trie*
+  first_child() const
+  {
+    return next_child(0);
+  }
+
+  /**
+   * @brief Child that follows child in the iteration order, the first one if child is null
+   */
+  radix_trie*
+  next_child(const radix_trie* child) const
+  {
+    if (capacity_ == 0) {
+      uint32_t i = 0;
+      if (child != 0) {
+        while (children_.inline_children[i] != child) {
+          ++i;
+        }
+        ++i;
+      }
+      return i < nChildren_ ? children_.inline_children[i] : 0;
+    }
+
+    for (size_t i = child == 0 ? 0 : find_slot(child) + 1; i < capacity_; ++i) {
+      if (children_.table[i] != 0) {
+        return children_.table[i];
+      }
+    }
+    return 0;
+  }
+
+  template<class T>
+  friend class radix_trie_iterator;
+
+  ////////////////////////////////////////////////
+  // Actual data
+  ////////////////////////////////////////////////
+
+  Key key_;            ///< first name component of the label
+  Key* tail_;          ///< other components of the label, if any
+  uint32_t labelSize_; ///< 0 for the root
+  uint32_t nChildren_;
+  uint32_t capacity_; ///< size of the children table, 0 if children are inline
+  size_t hash_;       ///< hash of key_, used by the children table of the parent
+
+  union {
+    radix_trie* inline_children[INLINE_CHILDREN];
+    radix_trie** table;
+  } children_;
+
+  typename PayloadTraits::storage_type payload_;
+  radix_trie* parent_;
+  pool_type* pool_;
+};
+
+template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+struct radix_trie<FullKey, PayloadTraits, PolicyHook>::pool_type
+  : public node_pool<sizeof(radix_trie<FullKey, PayloadTraits, PolicyHook>)> {
+};
+
+template<class Trie>
+class radix_trie_iterator {
+public:
+  radix_trie_iterator()
+    : trie_(0)
+  {
+  }
+  radix_trie_iterator(Trie* item)
+    : trie_(item)
+  {
+  }
+  radix_trie_iterator(Trie& item)
+    : trie_(&item)
+  {
+  }
+
+  Trie& operator*() const
+  {
+    return *trie_;
+  }
+  Trie* operator->() const
+  {
+    return trie_;
+  }
+  bool
+  operator==(const radix_trie_iterator& other) const
+  {
+    return trie_ == other.trie_;
+  }
+  bool
+  operator!=(const radix_trie_iterator& other) const
+  {
+    return trie_ != other.trie_;
+  }
+
+  radix_trie_iterator&
+  operator++(int)
+  {
+    Trie* child = trie_->first_child();
+    if (child != 0)
+      trie_ = child;
+    else
+      trie_ = goUp();
+    return *this;
+  }
+
+  radix_trie_iterator&
+  operator++()
+  {
+    (*this)++;
+    return *this;
+  }
+
+private:
+  Trie*
+  goUp()
+  {
+    for (Trie* node = trie_; node->parent_ != 0; node = node->parent_) {
+      Trie* sibling = node->parent_->next_child(node);
+      if (sibling != 0) {
+        return sibling;
+      }
+    }
+    return 0;
+  }
+
+private:
+  Trie* trie_;
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // RADIX_TRIE_H_
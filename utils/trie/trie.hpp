@@ -417,6 +417,30 @@ public:
     return 0;
   }
 
+  /**
+   * @brief Find the node of exactly key, whether or not it has payload
+   * @returns end() if there is no such node
+   */
+  inline iterator
+  find_exact(const FullKey& key)
+  {
+    iterator foundNode, lastNode;
+    bool reachLast;
+    std::tie(foundNode, reachLast, lastNode) = find(key);
+    return reachLast ? lastNode : 0;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie of key, checking predicate for the next level
+   */
+  template<class Predicate>
+  inline iterator
+  find_if_next_level(const FullKey& key, Predicate pred)
+  {
+    iterator node = find_exact(key);
+    return node != 0 ? node->find_if_next_level(pred) : 0;
+  }
+
   iterator
   end()
   {